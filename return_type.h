@@ -80,6 +80,37 @@ namespace rt {
 	};
 
 
+	// Primary template. Dot product of N element vectors.
+	template<typename T1, typename T2, uint N>
+	struct dot {
+		typedef void rt;
+	};
+
+	template<uint N>
+	struct dot<float, float, N> {
+		typedef float rt;
+	};
+
+
+	// Primary template. Sum of N elements.
+	template<typename T, uint N>
+	struct sum {
+		typedef void rt;
+	};
+
+	template<uint N>
+	struct sum<float, N> {
+		typedef float rt;
+	};
+
+
+	// Fused multiply-add, T1*T2 + T3.
+	template<typename T1, typename T2, typename T3>
+	struct fma {
+		typedef typename add_sub<typename mul<T1, T2>::rt, T3>::rt rt;
+	};
+
+
 	template<typename T1, typename T2>
 	struct cross {
 		typedef void rt;
@@ -91,6 +122,119 @@ namespace rt {
 	};
 
 
+	// Primary template. T is multiplicand and C is sf_const.
+	template<typename T, typename C>
+	struct mul_by {
+		typedef void rt;
+	};
+
+
+	// Primary template. T is dividend and C is sf_const.
+	template<typename T, typename C>
+	struct div_by {
+		typedef void rt;
+	};
+
+
+	// Squared magnitude of complex number.
+	template<typename T>
+	struct norm {
+		typedef void rt;
+	};
+
+
+	// Logarithms and exponentials.
+	template<typename T>
+	struct log2 {
+		typedef void rt;
+	};
+
+	template<typename T>
+	struct log {
+		typedef void rt;
+	};
+
+	template<typename T>
+	struct exp2 {
+		typedef void rt;
+	};
+
+	template<typename T>
+	struct exp {
+		typedef void rt;
+	};
+
+
+	// Rounding to integer, fraction and sign.
+	template<typename T>
+	struct floor {
+		typedef void rt;
+	};
+
+	template<typename T>
+	struct ceil {
+		typedef void rt;
+	};
+
+	template<typename T>
+	struct trunc {
+		typedef void rt;
+	};
+
+	template<typename T>
+	struct round {
+		typedef void rt;
+	};
+
+	// x - floor(x).
+	template<typename T>
+	struct fract {
+		typedef void rt;
+	};
+
+	// x - trunc(x).
+	template<typename T>
+	struct modf {
+		typedef void rt;
+	};
+
+	template<typename T>
+	struct sign {
+		typedef void rt;
+	};
+
+	// Type which holds both T1 and T2, for min() and max().
+	template<typename T1, typename T2>
+	struct min_max {
+		typedef void rt;
+	};
+
+	// Interpolation of T with weight A.
+	template<typename T, typename A>
+	struct mix {
+		typedef void rt;
+	};
+
+	template<typename T>
+	struct smoothstep {
+		typedef void rt;
+	};
+
+
+	// Multiplication by 2^K.
+	template<typename T, int K>
+	struct scale_pow2 {
+		typedef void rt;
+	};
+
+
+	// Mantissa in [0.5, 1) and runtime exponent.
+	template<typename T>
+	struct normalize_mantissa {
+		typedef void rt;
+	};
+
+
 	template<typename T>
 	struct normalize {
 		typedef void tr;
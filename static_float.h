@@ -158,6 +158,80 @@ namespace static_float {
 		};
 #endif
 
+		constexpr uint bit_width(uint64_t x) {
+			return x ? 1 + bit_width(x >> 1) : 0;
+		}
+
+		constexpr uint ceil_log2(uint64_t x) {
+			return x <= 1 ? 0 : bit_width(x - 1);
+		}
+
+		// Compile time math in long double, for tables and constants.
+
+		/**
+		 * @return 2^-i
+		 */
+		constexpr long double pow2_neg(uint i) {
+			return i == 0 ? 1.0L : 0.5L*pow2_neg(i - 1);
+		}
+
+		/**
+		 * @return 2^i
+		 */
+		constexpr long double pow2(uint i) {
+			return i == 0 ? 1.0L : 2.0L*pow2(i - 1);
+		}
+
+		/**
+		 * @return 2^i
+		 */
+		constexpr long double pow2i(int i) {
+			return i >= 0 ? pow2(uint(i)) : pow2_neg(uint(-i));
+		}
+
+		/**
+		 * Round to nearest, halves away from zero.
+		 */
+		constexpr int64_t round_ld(long double v) {
+			return v >= 0 ? int64_t(v + 0.5L) : -int64_t(-v + 0.5L);
+		}
+
+		/**
+		 * Indices for initialization of tables with pack expansion.
+		 */
+		template<uint... I>
+		struct index_seq {
+		};
+
+		template<typename S1, typename S2>
+		struct concat_index_seq;
+
+		template<uint... I1, uint... I2>
+		struct concat_index_seq<index_seq<I1...>, index_seq<I2...>> {
+			typedef index_seq<I1..., (sizeof...(I1) + I2)...> type;
+		};
+
+		/**
+		 * 0, 1, ..., N-1 in halves, so depth of recursion is log2(N).
+		 */
+		template<uint N>
+		struct make_index_seq {
+			typedef typename concat_index_seq<
+				typename make_index_seq<N/2>::type,
+				typename make_index_seq<N - N/2>::type
+			>::type type;
+		};
+
+		template<>
+		struct make_index_seq<0> {
+			typedef index_seq<> type;
+		};
+
+		template<>
+		struct make_index_seq<1> {
+			typedef index_seq<0> type;
+		};
+
 		/**
 		 * If integer part of usf for inversesqrt() is odd then expand B for 1.
 		 */
@@ -291,7 +365,7 @@ namespace static_float {
 			if(sh == 0){
 				num = m;
 			}else if(sh > 0){
-				num = m >> sh;
+				num = sh < 32 ? m >> sh : 0;
 			}else{
 				num = num_type(m) << -sh;
 			}
@@ -328,7 +402,7 @@ namespace static_float {
 			if(sh == 0){
 				num = m;
 			}else if(sh > 0){
-				num = m >> sh;
+				num = sh < 64 ? m >> sh : 0;
 			}else{
 				num = num_type(m) << -sh;
 			}
@@ -524,6 +598,22 @@ namespace static_float {
 			: num(u2.num) {
 		}
 
+		/**
+		 * Needed for value_type(0) in glm vectors.
+		 */
+		usf(int i) {
+#if STATIC_FLOAT_CHECKED_BUILD
+			if(i < 0){
+				throw exceptions::sign_error()
+					<< __PRETTY_FUNCTION__
+					<< " Negative number " << i
+					<< " cannot be converted to unsigned static float!"
+					<< exceptions::endl;
+			}
+#endif
+			*this = usf(uint(i));
+		}
+
 		usf(unsigned int i) {
 			// TODO Do STATIC_FLOAT_CHECKED_BUILD.
 			constexpr int sh = -E;
@@ -584,7 +674,7 @@ namespace static_float {
 			if(sh == 0){
 				num = m;
 			}else if(sh > 0){
-				num = m >> sh;
+				num = sh < 32 ? m >> sh : 0;
 			}else{
 				num = num_type(m) << -sh;
 			}
@@ -626,7 +716,7 @@ namespace static_float {
 			if(sh == 0){
 				num = m;
 			}else if(sh > 0){
-				num = m >> sh;
+				num = sh < 64 ? m >> sh : 0;
 			}else{
 				num = num_type(m) << -sh;
 			}
@@ -916,6 +1006,24 @@ namespace rt {
 		typedef static_float::sf<B1 + B2 + 2, E1 + E2> rt;
 	};
 
+	template<uint B1, int E1, uint B2, int E2>
+	struct dot2<static_float::sf<B1, E1>, static_float::sf<B2, E2>> {
+		typedef static_float::sf<B1 + B2 + 1, E1 + E2> rt;
+	};
+
+	/*
+	 * All N products are summed in single accumulator,
+	 * so sum grow for ceil(log2(N)) bits and not for 1 bit per addition.
+	 */
+	template<uint B1, int E1, uint B2, int E2, uint N>
+	struct dot<static_float::sf<B1, E1>, static_float::sf<B2, E2>, N> {
+		typedef static_float::sf<
+			B1 + B2 + static_float::detail::ceil_log2(N),
+			E1 + E2
+		> rt;
+		typedef typename rt::num_type ct;
+	};
+
 	template<uint B1, int E1, uint B2, int E2>
 	struct cross<static_float::sf<B1, E1>, static_float::sf<B2, E2>> {
 		typedef static_float::sf<B1 + B2 + 1, E1 + E2> rt;
@@ -953,6 +1061,37 @@ namespace rt {
 		typedef typename rt::num_type ct;
 	};
 
+	template<uint B1, int E1, uint B2, int E2, uint N>
+	struct dot<static_float::usf<B1, E1>, static_float::usf<B2, E2>, N> {
+		typedef static_float::usf<
+			B1 + B2 + static_float::detail::ceil_log2(N),
+			E1 + E2
+		> rt;
+		typedef typename rt::num_type ct;
+	};
+
+	template<uint B1, int E1, uint B2, int E2, uint N>
+	struct dot<static_float::sf<B1, E1>, static_float::usf<B2, E2>, N> {
+		typedef static_float::sf<
+			B1 + B2 + static_float::detail::ceil_log2(N),
+			E1 + E2
+		> rt;
+		typedef typename rt::num_type ct;
+	};
+
+	/*
+	 * Scaling by 2^K is only change of exponent, num is the same.
+	 */
+	template<uint B, int E, int K>
+	struct scale_pow2<static_float::sf<B, E>, K> {
+		typedef static_float::sf<B, E + K> rt;
+	};
+
+	template<uint B, int E, int K>
+	struct scale_pow2<static_float::usf<B, E>, K> {
+		typedef static_float::usf<B, E + K> rt;
+	};
+
 } // namespace rt
 
 
@@ -1072,6 +1211,10 @@ namespace static_float {
 		return r;
 	}
 
+	/**
+	 * Shift of num, which keeps type and loses low bits.
+	 * For exact shift use x >> shift<K>().
+	 */
 	template<uint B, int E>
 	usf<B, E>
 	operator>>(const usf<B, E>& u, int sh) {
@@ -1080,6 +1223,64 @@ namespace static_float {
 		return r;
 	}
 
+	////////////////////////////////////
+
+	/**
+	 * Compile time shift amount.
+	 * Usage: x >> shift<1>() is x/2 of type with exponent less by 1.
+	 */
+	template<uint K>
+	using shift = std::integral_constant<uint, K>;
+
+	/**
+	 * Multiply by 2^K. Only exponent of type is changed, so there is no
+	 * run time work and no bits are lost.
+	 * Usage: scale_pow2<-1>(a + b) is (a + b)/2.
+	 */
+	template<int K, uint B, int E>
+	typename rt::scale_pow2<sf<B, E>, K>::rt
+	scale_pow2(const sf<B, E>& x) {
+		typename rt::scale_pow2<sf<B, E>, K>::rt r;
+		r.num = x.num;
+		return r;
+	}
+
+	template<int K, uint B, int E>
+	typename rt::scale_pow2<usf<B, E>, K>::rt
+	scale_pow2(const usf<B, E>& x) {
+		typename rt::scale_pow2<usf<B, E>, K>::rt r;
+		r.num = x.num;
+		return r;
+	}
+
+	/// Same as scale_pow2(), named as std::ldexp().
+	template<int K, typename T>
+	typename rt::scale_pow2<T, K>::rt ldexp(const T& x) {
+		return scale_pow2<K>(x);
+	}
+
+	template<uint B, int E, uint K>
+	sf<B, E - int(K)> operator>>(const sf<B, E>& x, shift<K>) {
+		return scale_pow2<-int(K)>(x);
+	}
+
+	template<uint B, int E, uint K>
+	sf<B, E + int(K)> operator<<(const sf<B, E>& x, shift<K>) {
+		return scale_pow2<int(K)>(x);
+	}
+
+	template<uint B, int E, uint K>
+	usf<B, E - int(K)> operator>>(const usf<B, E>& x, shift<K>) {
+		return scale_pow2<-int(K)>(x);
+	}
+
+	template<uint B, int E, uint K>
+	usf<B, E + int(K)> operator<<(const usf<B, E>& x, shift<K>) {
+		return scale_pow2<int(K)>(x);
+	}
+
+	////////////////////////////////////
+
 
 	template<uint B1, int E1, uint B2, int E2>
 	typename rt::mul<sf<B1, E1>, usf<B2, E2>>::rt
@@ -1093,6 +1294,215 @@ namespace static_float {
 
 	////////////////////////////////////
 
+	namespace detail {
+		/**
+		 * Sum of N products of nums in single accumulator of type CT,
+		 * without re-aligning after each addition.
+		 */
+		template<typename CT, uint N, typename T1, typename T2>
+		CT dot_num(const T1* x, const T2* y) {
+			CT acc = 0;
+			for(uint i = 0; i < N; i++){
+				acc += CT(x[i].num) * CT(y[i].num);
+			}
+			return acc;
+		}
+	} // namespace detail
+
+	/**
+	 * Dot product of N element arrays.
+	 * Usage: dot<N>(x, y) for pointers or dot(x, y) for arrays.
+	 */
+	template<uint N, uint B1, int E1, uint B2, int E2>
+	typename rt::dot<sf<B1, E1>, sf<B2, E2>, N>::rt
+	dot(const sf<B1, E1>* x, const sf<B2, E2>* y) {
+		typedef typename rt::dot<sf<B1, E1>, sf<B2, E2>, N> d;
+		typename d::rt r;
+		r.num = detail::dot_num<typename d::ct, N>(x, y);
+		return r;
+	}
+
+	template<uint N, uint B1, int E1, uint B2, int E2>
+	typename rt::dot<usf<B1, E1>, usf<B2, E2>, N>::rt
+	dot(const usf<B1, E1>* x, const usf<B2, E2>* y) {
+		typedef typename rt::dot<usf<B1, E1>, usf<B2, E2>, N> d;
+		typename d::rt r;
+		r.num = detail::dot_num<typename d::ct, N>(x, y);
+		return r;
+	}
+
+	template<uint N, uint B1, int E1, uint B2, int E2>
+	typename rt::dot<sf<B1, E1>, usf<B2, E2>, N>::rt
+	dot(const sf<B1, E1>* x, const usf<B2, E2>* y) {
+		typedef typename rt::dot<sf<B1, E1>, usf<B2, E2>, N> d;
+		typename d::rt r;
+		r.num = detail::dot_num<typename d::ct, N>(x, y);
+		return r;
+	}
+
+	template<uint N, uint B1, int E1, uint B2, int E2>
+	typename rt::dot<sf<B1, E1>, sf<B2, E2>, N>::rt
+	dot(const sf<B1, E1> (&x)[N], const sf<B2, E2> (&y)[N]) {
+		return dot<N>(&x[0], &y[0]);
+	}
+
+	template<uint N, uint B1, int E1, uint B2, int E2>
+	typename rt::dot<usf<B1, E1>, usf<B2, E2>, N>::rt
+	dot(const usf<B1, E1> (&x)[N], const usf<B2, E2> (&y)[N]) {
+		return dot<N>(&x[0], &y[0]);
+	}
+
+	template<uint N, uint B1, int E1, uint B2, int E2>
+	typename rt::dot<sf<B1, E1>, usf<B2, E2>, N>::rt
+	dot(const sf<B1, E1> (&x)[N], const usf<B2, E2> (&y)[N]) {
+		return dot<N>(&x[0], &y[0]);
+	}
+
+	/**
+	 * Multiply and accumulate, acc += x*y.
+	 * Accumulator have exponent of product, so there is no re-aligning.
+	 * For N products use accumulator of type rt::dot<T1, T2, N>::rt.
+	 */
+	template<uint BA, int EA, uint B1, int E1, uint B2, int E2>
+	sf<BA, EA>&
+	mac(sf<BA, EA>& acc, const sf<B1, E1>& x, const sf<B2, E2>& y) {
+		static_assert(EA == E1 + E2, "Exponent of accumulator is wrong!");
+		static_assert(BA >= B1 + B2, "Accumulator is narrower than product!");
+		typedef typename sf<BA, EA>::num_type ct;
+		acc.num += ct(x.num) * ct(y.num);
+		return acc;
+	}
+
+	template<uint BA, int EA, uint B1, int E1, uint B2, int E2>
+	usf<BA, EA>&
+	mac(usf<BA, EA>& acc, const usf<B1, E1>& x, const usf<B2, E2>& y) {
+		static_assert(EA == E1 + E2, "Exponent of accumulator is wrong!");
+		static_assert(BA >= B1 + B2, "Accumulator is narrower than product!");
+		typedef typename usf<BA, EA>::num_type ct;
+		acc.num += ct(x.num) * ct(y.num);
+		return acc;
+	}
+
+	template<uint BA, int EA, uint B1, int E1, uint B2, int E2>
+	sf<BA, EA>&
+	mac(sf<BA, EA>& acc, const sf<B1, E1>& x, const usf<B2, E2>& y) {
+		static_assert(EA == E1 + E2, "Exponent of accumulator is wrong!");
+		static_assert(BA >= B1 + B2, "Accumulator is narrower than product!");
+		typedef typename sf<BA, EA>::num_type ct;
+		acc.num += ct(x.num) * ct(y.num);
+		return acc;
+	}
+
+	/**
+	 * Fused multiply-add, a*b + c.
+	 * Product is not rounded and it is added to c in calculation type
+	 * of sum, so there is only one growth for the addition.
+	 */
+	template<uint B1, int E1, uint B2, int E2, uint B3, int E3>
+	typename rt::fma<sf<B1, E1>, sf<B2, E2>, sf<B3, E3>>::rt
+	fma(const sf<B1, E1>& x, const sf<B2, E2>& y, const sf<B3, E3>& z) {
+		typedef typename rt::mul<sf<B1, E1>, sf<B2, E2>>::rt p_t;
+		typedef typename rt::add_sub<p_t, sf<B3, E3>> a;
+		typedef typename a::ct ct;
+		typename a::rt r;
+		r.num = ((ct(x.num) * ct(y.num)) << a::SH1) + (ct(z.num) << a::SH2);
+		return r;
+	}
+
+	template<uint B1, int E1, uint B2, int E2, uint B3, int E3>
+	typename rt::fma<usf<B1, E1>, usf<B2, E2>, usf<B3, E3>>::rt
+	fma(const usf<B1, E1>& x, const usf<B2, E2>& y, const usf<B3, E3>& z) {
+		typedef typename rt::mul<usf<B1, E1>, usf<B2, E2>>::rt p_t;
+		typedef typename rt::add_sub<p_t, usf<B3, E3>> a;
+		typedef typename a::ct ct;
+		typename a::rt r;
+		r.num = ((ct(x.num) * ct(y.num)) << a::SH1) + (ct(z.num) << a::SH2);
+		return r;
+	}
+
+	////////////////////////////////////
+
+	/**
+	 * Rounding modes for conversion to type with less fraction bits.
+	 */
+	enum round_mode {
+		/// Toward minus infinity, plain arithmetic shift.
+		round_floor,
+		/// Toward zero, same as integer division.
+		round_zero,
+		/// To nearest, halves toward plus infinity.
+		round_nearest,
+		/// To nearest, halves to even.
+		round_nearest_even
+	};
+
+	namespace detail {
+		/**
+		 * Shift v right for SH bits with rounding R.
+		 */
+		template<round_mode R, uint SH, typename T>
+		T round_shift(const T& v) {
+			if(SH == 0){
+				return v;
+			}
+			constexpr uint sh = SH == 0 ? 0 : SH;
+			const T half = T(1) << (SH == 0 ? 0 : SH - 1);
+			switch(R){
+			case round_floor:
+				return v >> sh;
+			case round_zero:
+				return (v + (v < 0 ? T((T(1) << sh) - 1) : T(0))) >> sh;
+			case round_nearest:
+				return (v + half) >> sh;
+			case round_nearest_even:
+				return (v + T(half - 1) + T((v >> sh) & 1)) >> sh;
+			}
+			return v;
+		}
+
+		template<uint B, int E>
+		constexpr bool is_signed_type(const sf<B, E>*) {
+			return true;
+		}
+
+		template<uint B, int E>
+		constexpr bool is_signed_type(const usf<B, E>*) {
+			return false;
+		}
+	} // namespace detail
+
+	/**
+	 * Convert static float x to type T with rounding R.
+	 * When S is true, results out of range of T are saturated to
+	 * min or max of T, and negative numbers are clamped to 0 for usf.
+	 * Usage: requantize<sf<7, -7>, round_nearest_even>(acc).
+	 */
+	template<typename T, round_mode R = round_nearest, bool S = true,
+		typename X>
+	T requantize(const X& x) {
+		constexpr int sh = T::e - X::e;
+		constexpr uint USH = sh > 0 ? sh : 0;
+		constexpr uint LSH = sh < 0 ? -sh : 0;
+		constexpr bool t_signed = detail::is_signed_type((T*)nullptr);
+		// One bit more for adding half in rounding.
+		typedef typename sf<
+			uint(rt::max(X::b + 1 + LSH, T::b + 1)), 0
+		>::num_type wt;
+
+		wt v = wt(x.num) << LSH;
+		v = detail::round_shift<R, USH>(v);
+		if(S){
+			const wt max = (wt(1) << T::b) - 1;
+			const wt min = t_signed ? wt(-(wt(1) << T::b)) : wt(0);
+			v = v > max ? max : v < min ? min : v;
+		}
+		T r;
+		r.num = typename T::num_type(v);
+		return r;
+	}
+
+	////////////////////////////////////
+
 } // namespace static_float
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,197 @@
+/**
+ * @file static_float_accumulator.h
+ * @date Oct 19, 2026
+ *
+ * @author Milos Subotic <milos.subotic.sm@gmail.com>
+ * @license MIT
+ *
+ * @brief Exact long accumulator for sums of many static floats.
+ *
+ * @version 1.0
+ * Changelog:
+ * 1.0 - Initial version.
+ *
+ */
+
+#ifndef STATIC_FLOAT_ACCUMULATOR_H_
+#define STATIC_FLOAT_ACCUMULATOR_H_
+
+///////////////////////////////////////////////////////////////////////////////
+
+#include <type_traits>
+
+#include "static_float.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+namespace static_float {
+
+	/**
+	 * @class sf_accumulator
+	 * @brief Exact sum of up to 2^LogTerms terms of type T,
+	 * ie. products of sf with type rt::mul.
+	 * Sums which fit in 64 bits are kept in one limb.
+	 * Wider sums are kept in carry-save form, term is split to 32 bit chunks
+	 * which are added to separate 64 bit limbs without carries,
+	 * so accumulation is O(1) and branch-free.
+	 * Carries are propagated only when result is read.
+	 * Partial accumulators of parallel reduction are merged with +=,
+	 * as long as total count of terms is within 2^LogTerms.
+	 * @param T type of terms
+	 * @param LogTerms log2 of maximal count of terms
+	 */
+	template<typename T, uint LogTerms = 32>
+	class sf_accumulator {
+	public:
+		typedef T term_type;
+
+		/// Bits of term with sign, term could be 2^b for product of -2^b.
+		static constexpr uint term_bits = T::b + 2;
+		/// Bits of exact sum with sign.
+		static constexpr uint bits = term_bits + LogTerms;
+		static constexpr bool narrow = bits <= 64;
+		/// Chunks of term, top chunk have at most 31 bits with sign.
+		static constexpr uint limbs = narrow ? 1 : term_bits/32 + 1;
+
+		static_assert(bits <= 126, "Sum is too wide!");
+		static_assert(
+			narrow || LogTerms <= 32,
+			"Carry-save limbs have room for 2^32 terms!"
+		);
+
+		////////////////////////////
+
+	private:
+		/// Limb i have weight 2^(32*i), top limb is signed.
+		uint64_t limb[limbs];
+
+		////////////////////////////
+
+	public:
+		sf_accumulator() {
+			clear();
+		}
+
+		void clear() {
+			for(uint i = 0; i < limbs; i++){
+				limb[i] = 0;
+			}
+		}
+
+		////////////////////////////
+
+	public:
+		void add(const T& x) {
+			if(narrow){
+				limb[0] += uint64_t(int64_t(x.num));
+			}else{
+				const detail::int128_t v = detail::int128_t(x.num);
+				for(uint i = 0; i + 1 < limbs; i++){
+					limb[i] += uint32_t(uint64_t(v >> (32*i)));
+				}
+				limb[limbs - 1] += uint64_t(int64_t(v >> (32*(limbs - 1))));
+			}
+		}
+
+		/**
+		 * Add x[i] for n terms.
+		 */
+		void add(const T* x, size_t n) {
+			for(size_t i = 0; i < n; i++){
+				add(x[i]);
+			}
+		}
+
+		/**
+		 * Add product a*b, which must be of type T.
+		 */
+		template<typename A, typename B>
+		void mac(const A& a, const B& b) {
+			static_assert(
+				std::is_same<typename rt::mul<A, B>::rt, T>::value,
+				"Product is not of term type!"
+			);
+			add(a*b);
+		}
+
+		/**
+		 * Add a[i]*b[i] for n pairs.
+		 */
+		template<typename A, typename B>
+		void dot(const A* a, const B* b, size_t n) {
+			for(size_t i = 0; i < n; i++){
+				mac(a[i], b[i]);
+			}
+		}
+
+		/**
+		 * Merge partial sum of other accumulator.
+		 */
+		sf_accumulator& operator+=(const sf_accumulator& o) {
+			for(uint i = 0; i < limbs; i++){
+				limb[i] += o.limb[i];
+			}
+			return *this;
+		}
+
+		////////////////////////////
+
+	public:
+		/**
+		 * Sum in units of 2^(T::e).
+		 */
+		detail::int128_t sum() const {
+			if(narrow){
+				return detail::int128_t(int64_t(limb[0]));
+			}
+			// Low limbs are at most 2^32*(2^32 - 1), so carry fits.
+			detail::int128_t s = 0;
+			uint64_t carry = 0;
+			for(uint i = 0; i + 1 < limbs; i++){
+				const uint64_t c = limb[i] + carry;
+				s |= detail::int128_t(uint32_t(c)) << (32*i);
+				carry = c >> 32;
+			}
+			const detail::int128_t top =
+				detail::int128_t(int64_t(limb[limbs - 1])) + carry;
+			return s + top*(detail::int128_t(1) << (32*(limbs - 1)));
+		}
+
+		/**
+		 * Sum rounded to R with rounding M and saturated.
+		 * Usage: acc.result<sf<15, -12>>().
+		 */
+		template<typename R, round_mode M = round_nearest>
+		R result() const {
+			constexpr int sh = R::e - T::e;
+			constexpr uint USH = sh > 0 ? sh : 0;
+			constexpr uint LSH = sh < 0 ? -sh : 0;
+			static_assert(USH < 127, "Result is too coarse!");
+			constexpr bool r_signed = detail::is_signed_type((R*)nullptr);
+			typedef detail::int128_t wt;
+
+			const wt max = (wt(1) << rt::min(R::b, 126)) - 1;
+			const wt min = r_signed ? -max - 1 : wt(0);
+			wt v = detail::round_shift<M, USH>(sum());
+			// Saturate before shift left, so that it cannot overflow.
+			if(LSH){
+				const wt lmax = max >> LSH;
+				const wt lmin = min >> LSH;
+				v = v > lmax ? max : v < lmin ? min : wt(v << LSH);
+			}
+			v = v > max ? max : v < min ? min : v;
+			R r;
+			r.num = typename R::num_type(v);
+			return r;
+		}
+
+		////////////////////////////
+	};
+
+	////////////////////////////////////
+
+} // namespace static_float
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // STATIC_FLOAT_ACCUMULATOR_H_
@@ -0,0 +1,375 @@
+/**
+ * @file static_float_atomic.h
+ * @date Oct 19, 2026
+ *
+ * @author Milos Subotic <milos.subotic.sm@gmail.com>
+ * @license MIT
+ *
+ * @brief Lock-free atomic static floats and striped sums.
+ *
+ * @version 1.0
+ * Changelog:
+ * 1.0 - Initial version.
+ *
+ */
+
+#ifndef STATIC_FLOAT_ATOMIC_H_
+#define STATIC_FLOAT_ATOMIC_H_
+
+///////////////////////////////////////////////////////////////////////////////
+
+#include <atomic>
+#include <type_traits>
+
+#include "static_float.h"
+#include "static_float_parallel.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+namespace static_float {
+
+	namespace detail {
+
+		/**
+		 * Failure order of compare exchange can't have release.
+		 */
+		constexpr int atomic_fail_order(std::memory_order o) {
+			return o == std::memory_order_acq_rel
+				? int(std::memory_order_acquire)
+				: o == std::memory_order_release
+					? int(std::memory_order_relaxed)
+					: int(o);
+		}
+
+		/**
+		 * Atomic operations on integer N of up to 64 bits,
+		 * with lock-free builtins.
+		 */
+		template<typename N, bool Wide = (sizeof(N) > 8)>
+		struct atomic_num {
+			static N load(const N* p, std::memory_order o) {
+				return __atomic_load_n(p, int(o));
+			}
+
+			static void store(N* p, N v, std::memory_order o) {
+				__atomic_store_n(p, v, int(o));
+			}
+
+			static N exchange(N* p, N v, std::memory_order o) {
+				return __atomic_exchange_n(p, v, int(o));
+			}
+
+			static bool cas(N* p, N& expected, N desired, bool weak,
+					std::memory_order o) {
+				return __atomic_compare_exchange_n(
+					p, &expected, desired, weak,
+					int(o), atomic_fail_order(o)
+				);
+			}
+
+			static N fetch_add(N* p, N v, std::memory_order o) {
+				return __atomic_fetch_add(p, v, int(o));
+			}
+		};
+
+		/**
+		 * Atomic operations on 128 bit integer, with cmpxchg16b.
+		 * Every operation is compare exchange, which is full barrier.
+		 */
+		template<typename N>
+		struct atomic_num<N, true> {
+#ifndef __GCC_HAVE_SYNC_COMPARE_AND_SWAP_16
+			static_assert(
+				sizeof(N) == 0,
+				"128 bit atomic needs cmpxchg16b, compile with -mcx16!"
+			);
+#endif
+
+			static N load(const N* p, std::memory_order) {
+				return __sync_val_compare_and_swap(const_cast<N*>(p), N(0), N(0));
+			}
+
+			static bool cas(N* p, N& expected, N desired, bool,
+					std::memory_order) {
+				const N old = __sync_val_compare_and_swap(p, expected, desired);
+				const bool ok = old == expected;
+				expected = old;
+				return ok;
+			}
+
+			static N exchange(N* p, N v, std::memory_order o) {
+				N old = load(p, o);
+				while(!cas(p, old, v, false, o)){
+				}
+				return old;
+			}
+
+			static void store(N* p, N v, std::memory_order o) {
+				exchange(p, v, o);
+			}
+
+			static N fetch_add(N* p, N v, std::memory_order o) {
+				N old = load(p, o);
+				while(!cas(p, old, N(old + v), false, o)){
+				}
+				return old;
+			}
+		};
+
+	} // namespace detail
+
+	////////////////////////////////////
+
+	/**
+	 * @class basic_atomic_sf
+	 * @brief Lock-free atomic static float T, sf or usf
+	 * of up to 64 bits, or 128 bits with cmpxchg16b.
+	 * Interface follows std::atomic.
+	 * fetch_add() and fetch_sub() wrap around as num_type does,
+	 * fetch_add_sat() saturates to range of T.
+	 * @param T static float type
+	 */
+	template<typename T>
+	class basic_atomic_sf {
+	public:
+		typedef T value_type;
+		typedef typename T::num_type num_type;
+
+		static_assert(
+			std::is_trivial<num_type>::value && sizeof(num_type) <= 16,
+			"Static float is too wide for atomic!"
+		);
+
+		static constexpr bool is_always_lock_free = true;
+
+		////////////////////////////
+
+	private:
+		typedef detail::atomic_num<num_type> ops;
+
+		static constexpr bool is_signed = detail::is_signed_type((T*)nullptr);
+		/// Built from two halves, so it does not overflow at full width.
+		static constexpr num_type max_num = num_type(
+			(num_type(1) << (T::b - 1)) - 1 + (num_type(1) << (T::b - 1))
+		);
+		static constexpr num_type min_num = is_signed ? -max_num - 1 : 0;
+
+		alignas(sizeof(num_type)) num_type num;
+
+		static T make(num_type n) {
+			T r;
+			r.num = n;
+			return r;
+		}
+
+		////////////////////////////
+
+	public:
+		basic_atomic_sf()
+			: num(0) {
+		}
+
+		basic_atomic_sf(const T& x)
+			: num(x.num) {
+		}
+
+		basic_atomic_sf(const basic_atomic_sf&) = delete;
+		basic_atomic_sf& operator=(const basic_atomic_sf&) = delete;
+
+		////////////////////////////
+
+	public:
+		T load(std::memory_order o = std::memory_order_seq_cst) const {
+			return make(ops::load(&num, o));
+		}
+
+		operator T() const {
+			return load();
+		}
+
+		void store(const T& x, std::memory_order o = std::memory_order_seq_cst) {
+			ops::store(&num, x.num, o);
+		}
+
+		basic_atomic_sf& operator=(const T& x) {
+			store(x);
+			return *this;
+		}
+
+		T exchange(const T& x, std::memory_order o = std::memory_order_seq_cst) {
+			return make(ops::exchange(&num, x.num, o));
+		}
+
+		bool compare_exchange_weak(
+			T& expected,
+			const T& desired,
+			std::memory_order o = std::memory_order_seq_cst
+		) {
+			return ops::cas(&num, expected.num, desired.num, true, o);
+		}
+
+		bool compare_exchange_strong(
+			T& expected,
+			const T& desired,
+			std::memory_order o = std::memory_order_seq_cst
+		) {
+			return ops::cas(&num, expected.num, desired.num, false, o);
+		}
+
+		////////////////////////////
+
+	public:
+		T fetch_add(const T& x, std::memory_order o = std::memory_order_seq_cst) {
+			return make(ops::fetch_add(&num, x.num, o));
+		}
+
+		T fetch_sub(const T& x, std::memory_order o = std::memory_order_seq_cst) {
+			return make(ops::fetch_add(&num, num_type(-x.num), o));
+		}
+
+		T operator+=(const T& x) {
+			return make(num_type(fetch_add(x).num + x.num));
+		}
+
+		T operator-=(const T& x) {
+			return make(num_type(fetch_sub(x).num - x.num));
+		}
+
+		/**
+		 * Add x, saturated to range of T.
+		 * @return previous value
+		 */
+		T fetch_add_sat(
+			const T& x,
+			std::memory_order o = std::memory_order_seq_cst
+		) {
+			num_type old = ops::load(&num, std::memory_order_relaxed);
+			num_type n;
+			do{
+				// Room to max or min is compared, so sum can't overflow.
+				n = x.num > 0
+					? old > num_type(max_num - x.num)
+						? num_type(max_num)
+						: num_type(old + x.num)
+					: old < num_type(min_num - x.num)
+						? num_type(min_num)
+						: num_type(old + x.num);
+			}while(!ops::cas(&num, old, n, true, o));
+			return make(old);
+		}
+
+		/**
+		 * Set to minimum of value and x.
+		 * @return previous value
+		 */
+		T fetch_min(const T& x, std::memory_order o = std::memory_order_seq_cst) {
+			num_type old = ops::load(&num, std::memory_order_relaxed);
+			while(x.num < old && !ops::cas(&num, old, x.num, true, o)){
+			}
+			return make(old);
+		}
+
+		/**
+		 * Set to maximum of value and x.
+		 * @return previous value
+		 */
+		T fetch_max(const T& x, std::memory_order o = std::memory_order_seq_cst) {
+			num_type old = ops::load(&num, std::memory_order_relaxed);
+			while(x.num > old && !ops::cas(&num, old, x.num, true, o)){
+			}
+			return make(old);
+		}
+
+		////////////////////////////
+	};
+
+	template<uint B, int E>
+	using atomic_sf = basic_atomic_sf<sf<B, E>>;
+
+	template<uint B, int E>
+	using atomic_usf = basic_atomic_sf<usf<B, E>>;
+
+	////////////////////////////////////
+
+	namespace detail {
+		/**
+		 * Default count of terms of B bits for sf_striped_sum,
+		 * as many as sum stays in 64 bits, but at most 2^32 - 1.
+		 */
+		constexpr uint striped_sum_terms(uint b) {
+			return b <= 31 ? 0xffffffff : b < 63 ? 1u << (63 - b) : 2;
+		}
+	} // namespace detail
+
+	/**
+	 * @class sf_striped_sum
+	 * @brief Sum of up to N terms of T added concurrently from many threads.
+	 * Every thread adds to one of Stripes atomic sums,
+	 * each in own cache line, so threads don't contend for same line.
+	 * Sum is exact, of type rt::sum<T, N>::rt.
+	 * Reading while other threads add gives sum of some of terms.
+	 * Default N keeps sum in 64 bits, so terms of more than 31 bits
+	 * get fewer than 2^32 terms. Sum wider than 64 bits needs -mcx16.
+	 * @param T type of terms
+	 * @param N maximal count of terms
+	 * @param Stripes count of partial sums
+	 */
+	template<
+		typename T,
+		uint N = detail::striped_sum_terms(T::b),
+		uint Stripes = 64
+	>
+	class sf_striped_sum {
+	public:
+		typedef typename rt::sum<T, N>::rt result_type;
+
+		////////////////////////////
+
+	private:
+		struct alignas(64) stripe {
+			basic_atomic_sf<result_type> sum;
+		};
+
+		stripe stripes[Stripes];
+
+		/// Threads get stripes in turn, on first add.
+		static uint stripe_index() {
+			static std::atomic<uint> next(0);
+			static thread_local uint index = next++ % Stripes;
+			return index;
+		}
+
+		////////////////////////////
+
+	public:
+		void add(const T& x) {
+			result_type r;
+			r.num = typename result_type::num_type(x.num);
+			stripes[stripe_index()].sum.fetch_add(r, std::memory_order_relaxed);
+		}
+
+		result_type sum() const {
+			result_type r;
+			r.num = 0;
+			for(const stripe& s : stripes){
+				r.num += s.sum.load(std::memory_order_relaxed).num;
+			}
+			return r;
+		}
+
+		void clear() {
+			result_type zero;
+			zero.num = 0;
+			for(stripe& s : stripes){
+				s.sum.store(zero, std::memory_order_relaxed);
+			}
+		}
+	};
+
+	////////////////////////////////////
+
+} // namespace static_float
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // STATIC_FLOAT_ATOMIC_H_
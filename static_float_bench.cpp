@@ -0,0 +1,1633 @@
+/**
+ * @file static_float_bench.cpp
+ * @date Oct 19, 2026
+ *
+ * @author Milos Subotic <milos.subotic.sm@gmail.com>
+ * @license MIT
+ *
+ * @brief static_float benchmark program.
+ *
+ * @version 1.0
+ * Changelog:
+ * 1.0 - Initial version.
+ *
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+#include <string>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <cstdlib>
+
+#if HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+using namespace std;
+
+#include "static_float.h"
+#include "static_float_vector_math.h"
+#include "static_float_gemm.h"
+#include "static_float_nn.h"
+#include "static_float_fir.h"
+#include "static_float_iir.h"
+#include "static_float_fft.h"
+#include "static_float_complex.h"
+#include "static_float_cordic.h"
+#include "static_float_exp_log.h"
+#include "static_float_lut.h"
+#include "static_float_poly.h"
+#include "static_float_accumulator.h"
+#include "static_float_parallel.h"
+#include "static_float_atomic.h"
+#include "static_float_span.h"
+#include "static_float_file.h"
+#include "static_float_codec.h"
+#include "static_float_decimal.h"
+#include "static_float_round.h"
+#include "static_float_bits.h"
+#include "static_float_block.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Run f() reps times.
+ * @return best time of single run in seconds.
+ */
+template<typename F>
+double best_time(uint reps, F f) {
+	double best = 1e30;
+	for(uint i = 0; i < reps; i++){
+		auto start = chrono::steady_clock::now();
+		f();
+		auto end = chrono::steady_clock::now();
+		double t = chrono::duration<double>(end - start).count();
+		if(t < best){
+			best = t;
+		}
+	}
+	return best;
+}
+
+#define REPORT(name, count, unit, t) \
+	do{ \
+		cout << name << ": " << (count) / (t) * 1e-6 \
+			<< " M" << unit << "/s" << endl; \
+	}while(0)
+
+/**
+ * Fold results to prevent dead code elimination.
+ */
+static int64_t checksum = 0;
+
+///////////////////////////////////////////////////////////////////////////////
+
+void bench_transform() {
+	using namespace static_float;
+	using namespace vector_math;
+
+	typedef sf<14, -14> vert_t;
+	typedef sf<14, -13> mat_t;
+	typedef rt::dot<mat_t, vert_t, 3>::rt out_t;
+
+	const size_t n = 4 << 20;
+
+	tmat3<mat_t> m;
+	tmat3<float> mf;
+	for(uint c = 0; c < 3; c++){
+		for(uint r = 0; r < 3; r++){
+			float f = 0.25f*c - 0.125f*r + (c == r ? 1 : 0);
+			m[c][r] = mat_t(f);
+			mf[c][r] = f;
+		}
+	}
+
+	vector<tvec3<vert_t>> in(n);
+	vector<tvec3<out_t>> out(n);
+	vector<glm::vec3> in_f(n);
+	vector<glm::vec3> out_f(n);
+	for(size_t i = 0; i < n; i++){
+		for(uint j = 0; j < 3; j++){
+			in[i][j].num = rand() % (1 << 15) - (1 << 14);
+			in_f[i][j] = float(in[i][j]);
+		}
+	}
+	glm::mat3 mg(
+		glm::vec3(mf[0].x, mf[0].y, mf[0].z),
+		glm::vec3(mf[1].x, mf[1].y, mf[1].z),
+		glm::vec3(mf[2].x, mf[2].y, mf[2].z)
+	);
+
+	double t = best_time(5, [&]{
+		transform(m, in.data(), out.data(), n);
+	});
+	REPORT("transform tmat3<sf<14, -13>> * tvec3<sf<14, -14>>",
+			n, "points", t);
+	checksum += out[n/2].x.num;
+
+	double tf = best_time(5, [&]{
+		for(size_t i = 0; i < n; i++){
+			out_f[i] = mg * in_f[i];
+		}
+	});
+	REPORT("transform mat3 * vec3", n, "points", tf);
+	checksum += int64_t(out_f[n/2].x);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void bench_gemm() {
+	using namespace static_float;
+
+	typedef sf<7, -7> w_t;
+	typedef usf<8, -8> a_t;
+	typedef sf<15, -8> c_t;
+	constexpr uint K = 512;
+	const size_t m = 512;
+	const size_t n = 512;
+	const double ops = 2.0*m*n*K;
+
+	vector<w_t> w(m*K);
+	vector<a_t> a(K*n);
+	vector<c_t> c(m*n);
+	vector<float> wf(m*K);
+	vector<float> af(K*n);
+	vector<float> cf(m*n);
+	for(size_t i = 0; i < w.size(); i++){
+		w[i].num = rand();
+		wf[i] = float(w[i]);
+	}
+	for(size_t i = 0; i < a.size(); i++){
+		a[i].num = rand();
+		af[i] = float(a[i]);
+	}
+
+	uint hw = max(1u, thread::hardware_concurrency());
+	for(uint threads = 1; ; threads = min(threads*2, hw)){
+		double t = best_time(3, [&]{
+			gemm<K>(m, n, w.data(), K, a.data(), n, c.data(), n, threads);
+		});
+		cout << "gemm sf<7, -7> x usf<8, -8> 512^3, " << threads
+			<< " threads: " << ops / t * 1e-9 << " GOPS" << endl;
+		checksum += c[m*n/2].num;
+		if(threads == hw){
+			break;
+		}
+	}
+
+	double tf = best_time(3, [&]{
+		for(size_t i = 0; i < m; i++){
+			for(size_t j = 0; j < n; j++){
+				cf[i*n + j] = 0;
+			}
+			for(size_t k = 0; k < K; k++){
+				float wik = wf[i*K + k];
+				for(size_t j = 0; j < n; j++){
+					cf[i*n + j] += wik * af[k*n + j];
+				}
+			}
+		}
+	});
+	cout << "sgemm reference loop 512^3: " << ops / tf * 1e-9 << " GFLOPS"
+		<< endl;
+	checksum += int64_t(cf[m*n/2]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void bench_nn() {
+	using namespace static_float;
+	using namespace static_float::nn;
+
+	typedef usf<8, -8> in_t;
+	typedef sf<7, -7> w_t;
+	typedef sf<15, -15> bias_t;
+	typedef usf<8, -6> act_t;
+	typedef sf<9, -6> pre_t;
+
+	const uint H = 224;
+	const uint W = 224;
+	const uint H2 = out_size(H, 3, 2);
+	const uint W2 = out_size(W, 3, 2);
+	const uint H4 = out_size(H2, 3, 2);
+	const uint W4 = out_size(W2, 3, 2);
+
+	tensor<in_t> in(3, H, W);
+	for(size_t i = 0; i < in.size(); i++){
+		in.data[i].num = rand();
+	}
+	auto init = [](vector<w_t>& w, vector<float>& wf) {
+		for(size_t i = 0; i < w.size(); i++){
+			w[i].num = rand() % 64 - 32;
+			wf[i] = float(w[i]);
+		}
+	};
+	vector<w_t> w1(16*3*9), w2(16*9), w3(32*16), w4(32*32*9);
+	vector<float> w1f(w1.size()), w2f(w2.size()), w3f(w3.size()),
+		w4f(w4.size());
+	init(w1, w1f);
+	init(w2, w2f);
+	init(w3, w3f);
+	init(w4, w4f);
+	vector<bias_t> bias(32, bias_t(0.125));
+
+	tensor<act_t> a1(16, H2, W2), a2(16, H2, W2), a3(32, H2, W2);
+	tensor<pre_t> p4(32, H4, W4);
+	tensor<usf<8, -8>> a4(32, H4, W4);
+	auto sigmoid = sigmoid_lut<pre_t, usf<8, -8>>();
+
+	uint threads = max(1u, thread::hardware_concurrency());
+	double t = best_time(5, [&]{
+		conv2d<3, 3, 3>(in, w1.data(), bias.data(), a1, 2, threads);
+		depthwise_conv2d<3, 3>(a1, w2.data(), bias.data(), a2, 1, threads);
+		conv2d<1, 1, 16>(a2, w3.data(), bias.data(), a3, 1, threads);
+		conv2d<3, 3, 32>(a3, w4.data(), bias.data(), p4, 2, threads);
+		sigmoid(p4, a4);
+	});
+	cout << "nn 3x224x224 conv/dw/1x1/conv/sigmoid, " << threads
+		<< " threads: " << 1 / t << " images/s" << endl;
+	checksum += a4.data[a4.size()/2].num;
+
+	// Same network in float with direct loops.
+	auto conv_f = [](
+		const vector<float>& in, uint ci, uint h, uint w,
+		const float* wt, uint co, uint k, uint stride, bool depthwise,
+		vector<float>& out, uint oh, uint ow
+	) {
+		int p = k/2;
+		for(uint o = 0; o < co; o++){
+			for(uint y = 0; y < oh; y++){
+				for(uint x = 0; x < ow; x++){
+					float acc = 0.125f;
+					uint c_begin = depthwise ? o : 0;
+					uint c_end = depthwise ? o + 1 : ci;
+					for(uint c = c_begin; c < c_end; c++){
+						const float* wc = depthwise
+							? wt + o*k*k
+							: wt + (o*ci + c)*k*k;
+						for(uint ky = 0; ky < k; ky++){
+							int iy = int(y*stride + ky) - p;
+							if(iy < 0 || iy >= int(h)){
+								continue;
+							}
+							for(uint kx = 0; kx < k; kx++){
+								int ix = int(x*stride + kx) - p;
+								if(ix < 0 || ix >= int(w)){
+									continue;
+								}
+								acc += wc[ky*k + kx]
+									* in[(size_t(c)*h + iy)*w + ix];
+							}
+						}
+					}
+					out[(size_t(o)*oh + y)*ow + x] = acc > 0 ? acc : 0;
+				}
+			}
+		}
+	};
+	vector<float> inf(in.size());
+	for(size_t i = 0; i < in.size(); i++){
+		inf[i] = float(in.data[i]);
+	}
+	vector<float> f1(a1.size()), f2(a2.size()), f3(a3.size()), f4(p4.size());
+	double tf = best_time(5, [&]{
+		conv_f(inf, 3, H, W, w1f.data(), 16, 3, 2, false, f1, H2, W2);
+		conv_f(f1, 16, H2, W2, w2f.data(), 16, 3, 1, true, f2, H2, W2);
+		conv_f(f2, 16, H2, W2, w3f.data(), 32, 1, 1, false, f3, H2, W2);
+		conv_f(f3, 32, H2, W2, w4f.data(), 32, 3, 2, false, f4, H4, W4);
+		for(size_t i = 0; i < f4.size(); i++){
+			f4[i] = 1/(1 + exp(-f4[i]));
+		}
+	});
+	cout << "nn float reference loops: " << 1 / tf << " images/s" << endl;
+	checksum += int64_t(f4[f4.size()/2]*256);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+template<uint N>
+void bench_fir_taps() {
+	using namespace static_float;
+
+	typedef sf<15, -15> x_t;
+	typedef sf<13, -15> c_t;
+	const size_t n = 1 << 20;
+	const size_t chunk = 4096;
+
+	vector<c_t> c(N);
+	vector<float> cf(N);
+	for(uint k = 0; k < N; k++){
+		c[k].num = rand() % 4096 - 2048;
+		cf[k] = float(c[k]);
+	}
+	vector<x_t> x(n);
+	vector<float> xf(n + N);
+	for(size_t i = 0; i < n; i++){
+		x[i].num = rand();
+		xf[N + i] = float(x[i]);
+	}
+	vector<x_t> y(n);
+	vector<float> yf(n);
+
+	fir<N, c_t, x_t> f(c.data());
+	double t = best_time(3, [&]{
+		for(size_t i = 0; i < n; i += chunk){
+			f.process(x.data() + i, y.data() + i, chunk);
+		}
+	});
+	cout << "fir sf<13, -15> x sf<15, -15> " << N << " taps: " << n / t * 1e-6 << " Msamples/s";
+	checksum += y[n/2].num;
+
+	fir_decimator<N, 4, c_t, x_t> d(c.data());
+	t = best_time(3, [&]{
+		size_t m = 0;
+		for(size_t i = 0; i < n; i += chunk){
+			m += d.process(x.data() + i, y.data() + m, chunk);
+		}
+	});
+	cout << ", decimate by 4: " << n / t * 1e-6 << " Msamples/s";
+	checksum += y[n/8].num;
+
+	double tf = best_time(3, [&]{
+		for(size_t i = 0; i < n; i++){
+			float acc = 0;
+			for(uint k = 0; k < N; k++){
+				acc += cf[k] * xf[N + i - k];
+			}
+			yf[i] = acc;
+		}
+	});
+	cout << ", float reference: " << n / tf * 1e-6 << " Msamples/s" << endl;
+	checksum += int64_t(yf[n/2]*32768);
+}
+
+void bench_fir() {
+	bench_fir_taps<8>();
+	bench_fir_taps<16>();
+	bench_fir_taps<32>();
+	bench_fir_taps<64>();
+	bench_fir_taps<128>();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void bench_iir() {
+	using namespace static_float;
+
+	typedef sf<15, -14> coef_t;
+	typedef sf<15, -15> x_t;
+	typedef biquad<coef_t, coef_t, x_t, x_t> stage_t;
+	const size_t total = 1 << 22;
+
+	coef_t b0[3] = {0.0675, 0.135, 0.0675};
+	coef_t a0[2] = {-1.143, 0.4128};
+	coef_t b1[3] = {0.25, 0.5, 0.25};
+	coef_t a1[2] = {-0.5, 0.1};
+	float b0f[3], a0f[2], b1f[3], a1f[2];
+	for(uint i = 0; i < 3; i++){
+		b0f[i] = float(b0[i]);
+		b1f[i] = float(b1[i]);
+	}
+	for(uint i = 0; i < 2; i++){
+		a0f[i] = float(a0[i]);
+		a1f[i] = float(a1[i]);
+	}
+
+	vector<x_t> x(total);
+	vector<x_t> y(total);
+	vector<float> xf(total);
+	vector<float> yf(total);
+	for(size_t i = 0; i < total; i++){
+		x[i].num = rand();
+		xf[i] = float(x[i]);
+	}
+
+	const uint channels[] = {1, 8, 64, 512};
+	for(uint C : channels){
+		const size_t n = total / C;
+		iir_cascade<stage_t, stage_t> f(
+			stage_t(C, b0, a0),
+			stage_t(C, b1, a1)
+		);
+		double t = best_time(3, [&]{
+			f.process(x.data(), y.data(), n);
+		});
+		cout << "iir 2 biquads sf<15, -14> x sf<15, -15>, " << C
+			<< " channels: " << total / t * 1e-6 << " Mchannel-samples/s";
+		checksum += y[total/2].num;
+
+		// Float reference, transposed direct form II with SoA state.
+		vector<float> s(4*C);
+		double tf = best_time(3, [&]{
+			for(uint i = 0; i < 4*C; i++){
+				s[i] = 0;
+			}
+			float* s0 = &s[0];
+			float* s1 = &s[C];
+			float* s2 = &s[2*C];
+			float* s3 = &s[3*C];
+			for(size_t t = 0; t < n; t++){
+				for(uint c = 0; c < C; c++){
+					float in = xf[t*C + c];
+					float u = b0f[0]*in + s0[c];
+					s0[c] = b0f[1]*in - a0f[0]*u + s1[c];
+					s1[c] = b0f[2]*in - a0f[1]*u;
+					float v = b1f[0]*u + s2[c];
+					s2[c] = b1f[1]*u - a1f[0]*v + s3[c];
+					s3[c] = b1f[2]*u - a1f[1]*v;
+					yf[t*C + c] = v;
+				}
+			}
+		});
+		cout << ", float reference: " << total / tf * 1e-6
+			<< " Mchannel-samples/s" << endl;
+		checksum += int64_t(yf[total/2]*32768);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+template<uint N>
+void bench_fft_size() {
+	using namespace static_float;
+
+	typedef sf<15, -15> x_t;
+	typedef fft<N, x_t> fft_t;
+	typedef typename fft_t::out_type y_t;
+	const uint reps = (1 << 24) / N / detail::ceil_log2(N);
+
+	vector<x_t> xr(N), xi(N);
+	vector<y_t> yr(N), yi(N);
+	for(uint i = 0; i < N; i++){
+		xr[i].num = rand();
+		xi[i].num = rand();
+	}
+	fft_t f;
+	double t = best_time(3, [&]{
+		for(uint r = 0; r < reps; r++){
+			f(xr.data(), xi.data(), yr.data(), yi.data());
+		}
+	});
+	cout << "fft " << N << " sf<15, -15>, growing: " << reps / t
+		<< " transforms/s";
+	checksum += yr[N/2].num;
+
+	// Float reference, same Stockham schedule.
+	vector<float> wr(N/2), wi(N/2);
+	for(uint k = 0; k < N/2; k++){
+		wr[k] = cos(6.283185307179586*k/N);
+		wi[k] = -sin(6.283185307179586*k/N);
+	}
+	vector<float> ar(N), ai(N), br(N), bi(N);
+	double tf = best_time(3, [&]{
+		for(uint r = 0; r < reps; r++){
+			for(uint i = 0; i < N; i++){
+				ar[i] = float(xr[i]);
+				ai[i] = float(xi[i]);
+			}
+			float* __restrict x_r = ar.data();
+			float* __restrict x_i = ai.data();
+			float* __restrict y_r = br.data();
+			float* __restrict y_i = bi.data();
+			for(uint s = 1, m = N/2; m >= 1; s *= 2, m /= 2){
+				for(uint p = 0; p < m; p++){
+					float w_r = wr[p*s];
+					float w_i = wi[p*s];
+					for(uint q = 0; q < s; q++){
+						float a_r = x_r[q + s*p], a_i = x_i[q + s*p];
+						float b_r = x_r[q + s*(p + m)], b_i = x_i[q + s*(p + m)];
+						y_r[q + s*2*p] = a_r + b_r;
+						y_i[q + s*2*p] = a_i + b_i;
+						float d_r = a_r - b_r, d_i = a_i - b_i;
+						y_r[q + s*(2*p + 1)] = d_r*w_r - d_i*w_i;
+						y_i[q + s*(2*p + 1)] = d_r*w_i + d_i*w_r;
+					}
+				}
+				swap(x_r, y_r);
+				swap(x_i, y_i);
+			}
+		}
+	});
+	cout << ", float reference: " << reps / tf << " transforms/s" << endl;
+	checksum += int64_t(br[N/2]);
+}
+
+void bench_fft() {
+	bench_fft_size<256>();
+	bench_fft_size<1024>();
+	bench_fft_size<16384>();
+	bench_fft_size<65536>();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Compare forms of complex product.
+ */
+template<typename W>
+void bench_complex_mul(const char* name, size_t n) {
+	using namespace static_float;
+
+	typedef typename rt::mul<W, W>::rt wp_t;
+	typedef typename W::value_type::num_type num_type;
+	vector<W> u(n), v(n);
+	vector<wp_t> w(n);
+	// All bits of parts are random.
+	for(size_t i = 0; i < n; i++){
+		num_type* p[4] = {&u[i].re.num, &u[i].im.num, &v[i].re.num, &v[i].im.num};
+		for(uint j = 0; j < 4; j++){
+			num_type a = 0;
+			for(uint k = 0; k + 31 <= W::b; k += 31){
+				a = a*num_type(1u << 31) + num_type(rand());
+			}
+			*p[j] = rand() & 1 ? num_type(-a) : a;
+		}
+	}
+	// Results are allocated before timing of both forms.
+	for(size_t i = 0; i < n; i++){
+		w[i] = mul4(u[i], v[i]);
+	}
+	double t4 = best_time(9, [&]{
+		for(size_t i = 0; i < n; i++){
+			w[i] = mul4(u[i], v[i]);
+		}
+	});
+	double t3 = best_time(9, [&]{
+		for(size_t i = 0; i < n; i++){
+			w[i] = mul3(u[i], v[i]);
+		}
+	});
+	cout << "complex mul " << name << ": 4-mult " << n / t4 * 1e-6
+		<< " Mmul/s, 3-mult " << n / t3 * 1e-6 << " Mmul/s, operator* uses "
+		<< (rt::mul<W, W>::mul3 ? "3-mult" : "4-mult") << endl;
+	checksum += w[n/2].re < wp_t(0.0).re;
+}
+
+void bench_complex() {
+	using namespace static_float;
+
+	typedef csf<15, -15> x_t;
+	typedef csf<40, -30> acc_t;
+	const size_t n = 4096;
+	const uint reps = 1000;
+
+	csf_array<x_t> x(n), y(n);
+	csf_array<acc_t> acc(n);
+	vector<complex<float>> xf(n), yf(n), accf(n);
+	for(size_t i = 0; i < n; i++){
+		x.re[i].num = rand();
+		x.im[i].num = rand();
+		y.re[i].num = rand();
+		y.im[i].num = rand();
+		acc.set(i, acc_t(0.0));
+		xf[i] = complex<float>(float(x.re[i]), float(x.im[i]));
+		yf[i] = complex<float>(float(y.re[i]), float(y.im[i]));
+	}
+
+	double t = best_time(3, [&]{
+		for(uint r = 0; r < reps; r++){
+			mac(acc, x, y);
+		}
+	});
+	REPORT("complex mac csf<15, -15> SoA", double(n)*reps, "MAC", t);
+	checksum += acc.re[n/2].num;
+
+	double tf = best_time(3, [&]{
+		for(uint r = 0; r < reps; r++){
+			for(size_t i = 0; i < n; i++){
+				accf[i] += xf[i]*yf[i];
+			}
+		}
+	});
+	REPORT("complex mac complex<float> AoS", double(n)*reps, "MAC", tf);
+	checksum += int64_t(accf[n/2].real());
+
+	bench_complex_mul<csf<60, -60>>("csf<60, -60>", 1 << 20);
+#ifdef HAVE_GMP
+	bench_complex_mul<csf<100, -100>>("csf<100, -100>", 1 << 14);
+	bench_complex_mul<csf<2000, -2000>>("csf<2000, -2000>", 1 << 11);
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void bench_cordic() {
+	using namespace static_float;
+
+	typedef sf<15, -12> a_t;
+	typedef sf<15, -14> u_t;
+	const size_t n = 4096;
+	const uint reps = 200;
+
+	vector<a_t> th(n);
+	vector<u_t> s(n), c(n);
+	vector<float> thf(n), sf_(n), cf(n);
+	for(size_t i = 0; i < n; i++){
+		th[i].num = int16_t(rand());
+		thf[i] = float(th[i]);
+	}
+
+	double tb = best_time(3, [&]{
+		for(uint r = 0; r < reps; r++){
+			sincos(th.data(), s.data(), c.data(), n);
+		}
+	});
+	REPORT("sincos sf<15, -12> CORDIC batch", double(n)*reps, "sincos", tb);
+	checksum += s[n/2].num + c[n/3].num;
+
+	double ts = best_time(3, [&]{
+		for(uint r = 0; r < reps; r++){
+			for(size_t i = 0; i < n; i++){
+				sincos(th[i], s[i], c[i]);
+			}
+		}
+	});
+	REPORT("sincos sf<15, -12> CORDIC scalar", double(n)*reps, "sincos", ts);
+	checksum += s[n/2].num + c[n/3].num;
+
+	double tf = best_time(3, [&]{
+		for(uint r = 0; r < reps; r++){
+			for(size_t i = 0; i < n; i++){
+				sf_[i] += std::sin(thf[i]);
+				cf[i] += std::cos(thf[i]);
+			}
+		}
+	});
+	REPORT("sincos float std::sin std::cos", double(n)*reps, "sincos", tf);
+	checksum += int64_t(sf_[n/2]*1000) + int64_t(cf[n/3]*1000);
+
+	// Float reference converts from and to static float in hot loop.
+	double tc = best_time(3, [&]{
+		for(uint r = 0; r < reps; r++){
+			for(size_t i = 0; i < n; i++){
+				float t = float(th[i]);
+				s[i] = u_t(std::sin(t));
+				c[i] = u_t(std::cos(t));
+			}
+		}
+	});
+	REPORT("sincos sf<15, -12> via float", double(n)*reps, "sincos", tc);
+	checksum += s[n/2].num + c[n/3].num;
+
+	vector<a_t> y(n);
+	vector<sf<15, -13>> a(n);
+	for(size_t i = 0; i < n; i++){
+		y[i].num = int16_t(rand());
+	}
+	double ta = best_time(3, [&]{
+		for(uint r = 0; r < reps; r++){
+			for(size_t i = 0; i < n; i++){
+				a[i] = atan2(y[i], th[i]);
+			}
+		}
+	});
+	REPORT("atan2 sf<15, -12> CORDIC", double(n)*reps, "atan2", ta);
+	checksum += a[n/2].num;
+
+	// Error report against double, in LSB of result.
+	double max_s = 0, max_a = 0;
+	sincos(th.data(), s.data(), c.data(), n);
+	for(size_t i = 0; i < n; i++){
+		double d = std::sin(double(th[i]));
+		max_s = max(max_s, fabs(double(s[i]) - d)*16384);
+		double da = std::atan2(double(y[i]), double(th[i]));
+		max_a = max(max_a, fabs(double(a[i]) - da)*8192);
+	}
+	cout << "CORDIC max error: sin " << max_s << " LSB, atan2 "
+		<< max_a << " LSB" << endl;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void bench_exp_log() {
+	using namespace static_float;
+
+	typedef usf<16, -16> x_t;
+	typedef sf<15, -12> a_t;
+	const size_t n = 4096;
+	const uint reps = 500;
+
+	vector<x_t> x(n);
+	vector<a_t> a(n);
+	vector<float> xf(n), af(n), yf(n);
+	for(size_t i = 0; i < n; i++){
+		x[i].num = uint16_t(rand() | 1);
+		a[i].num = int16_t(rand());
+		xf[i] = float(x[i]);
+		af[i] = float(a[i]);
+	}
+
+	vector<rt::log2<x_t>::rt> l2(n);
+	double t = best_time(3, [&]{
+		for(uint r = 0; r < reps; r++){
+			log2(x.data(), l2.data(), n);
+		}
+	});
+	REPORT("log2 usf<16, -16> batch", double(n)*reps, "log2", t);
+	checksum += l2[n/2].num;
+
+	double tf = best_time(3, [&]{
+		for(uint r = 0; r < reps; r++){
+			for(size_t i = 0; i < n; i++){
+				yf[i] += std::log2(xf[i]);
+			}
+		}
+	});
+	REPORT("log2 float std::log2", double(n)*reps, "log2", tf);
+	checksum += int64_t(yf[n/2]);
+
+	vector<rt::exp2<a_t>::rt> e2(n);
+	t = best_time(3, [&]{
+		for(uint r = 0; r < reps; r++){
+			exp2(a.data(), e2.data(), n);
+		}
+	});
+	REPORT("exp2 sf<15, -12> batch", double(n)*reps, "exp2", t);
+	checksum += e2[n/2].num;
+
+	tf = best_time(3, [&]{
+		for(uint r = 0; r < reps; r++){
+			for(size_t i = 0; i < n; i++){
+				yf[i] += std::exp2(af[i]);
+			}
+		}
+	});
+	REPORT("exp2 float std::exp2", double(n)*reps, "exp2", tf);
+	checksum += int64_t(yf[n/2]);
+
+	vector<rt::log<x_t>::rt> l(n);
+	t = best_time(3, [&]{
+		for(uint r = 0; r < reps; r++){
+			log(x.data(), l.data(), n);
+		}
+	});
+	REPORT("log usf<16, -16> batch", double(n)*reps, "log", t);
+	checksum += l[n/2].num;
+
+	vector<rt::exp<a_t>::rt> e(n);
+	t = best_time(3, [&]{
+		for(uint r = 0; r < reps; r++){
+			exp(a.data(), e.data(), n);
+		}
+	});
+	REPORT("exp sf<15, -12> batch", double(n)*reps, "exp", t);
+	checksum += e[n/2].num;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+struct bench_sigmoid_fn {
+	double operator()(double x) const {
+		return 1/(1 + exp(-x));
+	}
+};
+
+void bench_lut() {
+	using namespace static_float;
+
+	typedef sf<20, -16> x_t;
+	typedef usf<16, -16> y_t;
+	const size_t n = 4096;
+	const uint reps = 500;
+
+	vector<x_t> x(n);
+	vector<y_t> y(n);
+	vector<float> xf(n), yf(n);
+	for(size_t i = 0; i < n; i++){
+		x[i].num = rand() % (1 << 21) - (1 << 20);
+		xf[i] = float(x[i]);
+	}
+
+	sf_lut<bench_sigmoid_fn, x_t, y_t, 8, lut_linear> sl;
+	double t = best_time(3, [&]{
+		for(uint r = 0; r < reps; r++){
+			sl(x.data(), y.data(), n);
+		}
+	});
+	REPORT("sigmoid sf_lut linear", double(n)*reps, "op", t);
+	checksum += y[n/2].num;
+
+	sf_lut<bench_sigmoid_fn, x_t, y_t, 8, lut_quadratic> sq;
+	t = best_time(3, [&]{
+		for(uint r = 0; r < reps; r++){
+			sq(x.data(), y.data(), n);
+		}
+	});
+	REPORT("sigmoid sf_lut quadratic", double(n)*reps, "op", t);
+	checksum += y[n/2].num;
+
+	double tf = best_time(3, [&]{
+		for(uint r = 0; r < reps; r++){
+			for(size_t i = 0; i < n; i++){
+				yf[i] += 1/(1 + std::exp(-xf[i]));
+			}
+		}
+	});
+	REPORT("sigmoid float std::exp", double(n)*reps, "op", tf);
+	checksum += int64_t(yf[n/2]);
+}
+
+void bench_poly() {
+	using namespace static_float;
+
+	// Taylor series of exp, with coefficients in Q20.
+	typedef sf_const<1> c0;
+	typedef sf_const<1> c1;
+	typedef sf_const<1, -1> c2;
+	typedef sf_const<174763, -20> c3;
+	typedef sf_const<43691, -20> c4;
+	typedef sf_const<8738, -20> c5;
+	typedef sf_const<1456, -20> c6;
+	typedef sf_const<208, -20> c7;
+	const float c[] = {
+		1, 1, 0.5f, ldexp(174763.0f, -20), ldexp(43691.0f, -20),
+		ldexp(8738.0f, -20), ldexp(1456.0f, -20), ldexp(208.0f, -20)
+	};
+
+	typedef usf<16, -16> x_t;
+	typedef sf<20, -18> y_t;
+	const size_t n = 4096;
+	const uint reps = 500;
+
+	vector<x_t> x(n);
+	vector<y_t> y(n);
+	vector<float> xf(n), yf(n);
+	for(size_t i = 0; i < n; i++){
+		x[i].num = rand() % (1 << 16);
+		xf[i] = float(x[i]);
+	}
+
+	// Inputs change between repetitions, so work is not hoisted.
+	double t = best_time(3, [&]{
+		for(uint r = 0; r < reps; r++){
+			poly_eval<y_t, c0, c1, c2, c3, c4, c5, c6, c7>(
+				x.data(), y.data(), n
+			);
+			x[r % n].num ^= 1;
+		}
+	});
+	REPORT("poly deg 7 Horner", double(n)*reps, "op", t);
+	checksum += y[n/2].num;
+
+	t = best_time(3, [&]{
+		for(uint r = 0; r < reps; r++){
+			poly_eval_estrin<y_t, c0, c1, c2, c3, c4, c5, c6, c7>(
+				x.data(), y.data(), n
+			);
+			x[r % n].num ^= 1;
+		}
+	});
+	REPORT("poly deg 7 Estrin", double(n)*reps, "op", t);
+	checksum += y[n/2].num;
+
+	double tf = best_time(3, [&]{
+		for(uint r = 0; r < reps; r++){
+			for(size_t i = 0; i < n; i++){
+				float p = c[7];
+				for(int k = 6; k >= 0; k--){
+					p = p*xf[i] + c[k];
+				}
+				yf[i] += p;
+			}
+			xf[r % n] = -xf[r % n];
+		}
+	});
+	REPORT("poly deg 7 float Horner", double(n)*reps, "op", tf);
+	checksum += int64_t(yf[n/2]);
+}
+
+void bench_accumulator() {
+	using namespace static_float;
+
+	typedef sf<15, -15> a_t;
+	typedef sf<31, -31> w_t;
+	const size_t n = 1 << 16;
+	const uint reps = 100;
+
+	vector<a_t> a(n), b(n);
+	vector<w_t> wa(n), wb(n);
+	vector<double> da(n), db(n);
+	for(size_t i = 0; i < n; i++){
+		a[i].num = int16_t(rand());
+		b[i].num = int16_t(rand());
+		wa[i].num = int32_t(rand()*2 + (rand() & 1));
+		wb[i].num = int32_t(rand()*2 + (rand() & 1));
+		da[i] = ldexp(double(wa[i].num), -31);
+		db[i] = ldexp(double(wb[i].num), -31);
+	}
+
+	// Inputs change between repetitions, so work is not hoisted.
+	double t = best_time(3, [&]{
+		for(uint r = 0; r < reps; r++){
+			sf_accumulator<rt::mul<a_t, a_t>::rt> acc;
+			acc.dot(a.data(), b.data(), n);
+			checksum += int64_t(acc.sum());
+			a[r % n].num ^= 1;
+		}
+	});
+	REPORT("sum of sf<15, -15> products, 1 limb", double(n)*reps, "MAC", t);
+
+	t = best_time(3, [&]{
+		for(uint r = 0; r < reps; r++){
+			sf_accumulator<rt::mul<w_t, w_t>::rt> acc;
+			acc.dot(wa.data(), wb.data(), n);
+			checksum += int64_t(acc.sum());
+			wa[r % n].num ^= 1;
+		}
+	});
+	REPORT("sum of sf<31, -31> products, carry-save", double(n)*reps, "MAC", t);
+
+	double tf = best_time(3, [&]{
+		for(uint r = 0; r < reps; r++){
+			double acc = 0;
+			for(size_t i = 0; i < n; i++){
+				acc += da[i]*db[i];
+			}
+			checksum += int64_t(acc);
+			da[r % n] = -da[r % n];
+		}
+	});
+	REPORT("sum of double products", double(n)*reps, "MAC", tf);
+
+#ifdef HAVE_GMP
+	t = best_time(3, [&]{
+		for(uint r = 0; r < reps/10; r++){
+			mpz_class acc = 0;
+			mpz_class p;
+			for(size_t i = 0; i < n; i++){
+				mpz_set_si(p.get_mpz_t(), long(wa[i].num)*long(wb[i].num));
+				acc += p;
+			}
+			checksum += int64_t(acc.get_si());
+			wa[r % n].num ^= 1;
+		}
+	});
+	REPORT("sum of sf<31, -31> products, mpz", double(n)*(reps/10), "MAC", t);
+#endif
+}
+
+void bench_parallel() {
+	using namespace static_float;
+
+	typedef sf<15, -15> x_t;
+	const uint N = 1 << 24;
+	const size_t n = N;
+	const uint reps = 10;
+
+	vector<x_t> x(n), y(n);
+	for(size_t i = 0; i < n; i++){
+		x[i].num = int16_t(rand());
+		y[i].num = int16_t(rand());
+	}
+
+	const uint max_threads = parallel::thread_pool::default_threads();
+	for(uint threads = 1; threads <= max_threads; threads *= 2){
+		parallel::thread_pool pool(threads);
+		string name = " with " + to_string(threads) + " threads";
+
+		double t = best_time(3, [&]{
+			for(uint r = 0; r < reps; r++){
+				checksum += parallel::reduce<N>(x.data(), n, pool).num;
+				x[r].num ^= 1;
+			}
+		});
+		REPORT("parallel::reduce sf<15, -15>" + name, double(n)*reps, "add", t);
+
+		t = best_time(3, [&]{
+			for(uint r = 0; r < reps; r++){
+				checksum += parallel::transform_reduce<N>(
+					x.data(), y.data(), n, pool
+				).num;
+				x[r].num ^= 1;
+			}
+		});
+		REPORT("parallel::transform_reduce dot" + name, double(n)*reps, "MAC", t);
+	}
+}
+
+/**
+ * Run f(t) in threads t of count.
+ */
+template<typename F>
+void run_threads(uint count, const F& f) {
+	vector<thread> ts;
+	for(uint t = 0; t < count; t++){
+		ts.emplace_back(f, t);
+	}
+	for(thread& t : ts){
+		t.join();
+	}
+}
+
+void bench_atomic() {
+	using namespace static_float;
+
+	typedef sf<15, -15> x_t;
+	typedef sf<47, -15> s_t;
+	const uint n = 1 << 20;
+
+	const uint max_threads = parallel::thread_pool::default_threads();
+	for(uint threads = 1; threads <= max_threads; threads *= 2){
+		string name = " with " + to_string(threads) + " threads";
+		const double adds = double(n)*threads;
+
+		mutex m;
+		s_t locked;
+		locked.num = 0;
+		double t = best_time(3, [&]{
+			run_threads(threads, [&](uint k){
+				for(uint i = 0; i < n; i++){
+					lock_guard<mutex> l(m);
+					locked.num += int16_t(i + k);
+				}
+			});
+		});
+		REPORT("sf sum under mutex" + name, adds, "add", t);
+		checksum += locked.num;
+
+		basic_atomic_sf<s_t> shared;
+		t = best_time(3, [&]{
+			run_threads(threads, [&](uint k){
+				for(uint i = 0; i < n; i++){
+					s_t x;
+					x.num = int16_t(i + k);
+					shared.fetch_add(x, memory_order_relaxed);
+				}
+			});
+		});
+		REPORT("atomic_sf fetch_add" + name, adds, "add", t);
+		checksum += shared.load().num;
+
+		sf_striped_sum<x_t> striped;
+		t = best_time(3, [&]{
+			run_threads(threads, [&](uint k){
+				for(uint i = 0; i < n; i++){
+					x_t x;
+					x.num = int16_t(i + k);
+					striped.add(x);
+				}
+			});
+		});
+		REPORT("sf_striped_sum add" + name, adds, "add", t);
+		checksum += striped.sum().num;
+	}
+}
+
+void bench_span() {
+	using namespace static_float;
+
+	typedef sf<15, -15> x_t;
+	const uint N = 1 << 22;
+	const size_t n = N;
+	const uint reps = 20;
+
+	vector<int16_t> raw(n);
+	for(size_t i = 0; i < n; i++){
+		raw[i] = int16_t(rand());
+	}
+	parallel::thread_pool pool(1);
+
+	// Ingest of buffer, copy to vector of sf, and view of it.
+	vector<x_t> copy(n);
+	double t = best_time(3, [&]{
+		for(uint r = 0; r < reps; r++){
+			for(size_t i = 0; i < n; i++){
+				copy[i].num = raw[i];
+			}
+			checksum += parallel::reduce<N>(copy.data(), n, pool).num;
+			raw[r] ^= 1;
+		}
+	});
+	REPORT("ingest int16_t with copy to sf, sum", double(n)*reps, "sample", t);
+
+	t = best_time(3, [&]{
+		for(uint r = 0; r < reps; r++){
+			sf_span<15, -15> s(raw.data(), n);
+			checksum += parallel::reduce<N>(s.data(), s.size(), pool).num;
+			raw[r] ^= 1;
+		}
+	});
+	REPORT("ingest int16_t with sf_span, sum", double(n)*reps, "sample", t);
+}
+
+void bench_file() {
+	using namespace static_float;
+
+	typedef sf<15, -15> x_t;
+	const uint N = 1 << 22;
+	const size_t n = N;
+	const char* path = "static_float_bench.sfa";
+	const char* text_path = "static_float_bench.txt";
+	parallel::thread_pool pool(1);
+
+	vector<x_t> x(n);
+	for(size_t i = 0; i < n; i++){
+		x[i].num = int16_t(rand());
+	}
+	FILE* f = fopen(text_path, "w");
+	for(size_t i = 0; i < n; i++){
+		fprintf(f, "%.9g\n", double(x[i]));
+	}
+	fclose(f);
+
+	// Load of file and sum of it, from page cache.
+	write_sf_file(path, x.data(), n);
+	double t = best_time(3, [&]{
+		sf_file file(path);
+		const_sf_span<15, -15> v = file.view<x_t>();
+		checksum += parallel::reduce<N>(v.data(), v.size(), pool).num;
+	});
+	REPORT("sf_file view, sum", double(n), "sample", t);
+
+	t = best_time(3, [&]{
+		sf_file file(path);
+		vector<sf<20, -17>> v = file.load<sf<20, -17>>();
+		checksum += parallel::reduce<N>(v.data(), v.size(), pool).num;
+	});
+	REPORT("sf_file convert, sum", double(n), "sample", t);
+
+	write_sf_file(path, x.data(), n, sf_file_bits);
+	t = best_time(3, [&]{
+		sf_file file(path);
+		vector<x_t> v = file.load<x_t>();
+		checksum += parallel::reduce<N>(v.data(), v.size(), pool).num;
+	});
+	REPORT("sf_file unpack bits, sum", double(n), "sample", t);
+
+	t = best_time(3, [&]{
+		FILE* f = fopen(text_path, "r");
+		vector<x_t> v(n);
+		char line[64];
+		for(size_t i = 0; i < n && fgets(line, sizeof(line), f); i++){
+			v[i] = x_t(strtod(line, nullptr));
+		}
+		fclose(f);
+		checksum += parallel::reduce<N>(v.data(), v.size(), pool).num;
+	});
+	REPORT("parse text, sum", double(n), "sample", t);
+
+	remove(path);
+	remove(text_path);
+}
+
+void bench_codec() {
+	using namespace static_float;
+
+	typedef sf<24, -8> x_t;
+	const size_t n = 1 << 22;
+	const double raw_bytes = double(n)*sizeof(int32_t);
+
+	// Slow signal with noise of few LSBs, as from sensor.
+	vector<x_t> x(n);
+	for(size_t i = 0; i < n; i++){
+		x[i].num = int32_t(floor(4e6*sin(i*1e-4) + 1e5*sin(i*3e-3) + 0.5))
+			+ rand() % 9 - 4;
+	}
+	vector<x_t> y(n);
+
+	sf_compressed<x_t> c;
+	double t = best_time(3, [&]{
+		c = sf_compressed<x_t>(x.data(), n);
+	});
+	REPORT("sf_compressed encode", raw_bytes, "B", t);
+	cout << "sf_compressed ratio: "
+		<< raw_bytes/double(c.data().size()) << endl;
+
+	t = best_time(5, [&]{
+		c.decode(y.data());
+		checksum += y[n/2].num;
+	});
+	REPORT("sf_compressed decode", raw_bytes, "B", t);
+
+	t = best_time(5, [&]{
+		sf_decoder<x_t> dec(c.data().data(), c.data().size());
+		for(size_t i = 0; i < n; i += 1000){
+			checksum += dec.read(y.data() + i, n - i < 1000 ? n - i : 1000);
+		}
+	});
+	REPORT("sf_decoder read by 1000", raw_bytes, "B", t);
+
+	const uint accesses = 1 << 16;
+	t = best_time(3, [&]{
+		for(uint k = 0; k < accesses; k++){
+			checksum += c.at((size_t(k)*2654435761u) % n).num;
+		}
+	});
+	REPORT("sf_compressed random access", double(accesses), "access", t);
+
+	t = best_time(5, [&]{
+		for(size_t i = 0; i < n; i++){
+			y[i] = x[i];
+		}
+		checksum += y[n/3].num;
+	});
+	REPORT("raw copy", raw_bytes, "B", t);
+
+#if HAVE_ZLIB
+	for(int level : {1, 6}){
+		vector<Bytef> z(compressBound(uLong(raw_bytes)));
+		uLongf z_size = 0;
+		t = best_time(1, [&]{
+			z_size = z.size();
+			compress2(
+				z.data(),
+				&z_size,
+				reinterpret_cast<const Bytef*>(x.data()),
+				uLong(raw_bytes),
+				level
+			);
+		});
+		const string name = "zlib level " + to_string(level);
+		REPORT(name + " compress", raw_bytes, "B", t);
+		cout << name << " ratio: " << raw_bytes/double(z_size) << endl;
+		t = best_time(3, [&]{
+			uLongf size = uLongf(raw_bytes);
+			uncompress(reinterpret_cast<Bytef*>(y.data()), &size, z.data(), z_size);
+			checksum += y[n/2].num;
+		});
+		REPORT(name + " decompress", raw_bytes, "B", t);
+	}
+#endif
+}
+
+template<typename T>
+void bench_decimal_type(const string& name) {
+	using namespace static_float;
+
+	const size_t n = 1 << 21;
+	vector<T> x(n), y(n);
+	for(size_t i = 0; i < n; i++){
+		x[i].num = typename T::num_type(rand()) - typename T::num_type(RAND_MAX/2);
+	}
+	vector<char> text(n*(max_decimal_chars<T>() + 1));
+	char* end = nullptr;
+
+	double t = best_time(3, [&]{
+		end = format_csv_column(x.data(), n, text.data());
+		x[0].num ^= 1;
+	});
+	const double bytes = double(end - text.data());
+	REPORT("format_csv_column " + name, bytes, "B", t);
+
+	t = best_time(3, [&]{
+		checksum += parse_csv_column(text.data(), end, y.data(), n);
+		checksum += y[n/2].num;
+	});
+	REPORT("parse_csv_column " + name, bytes, "B", t);
+
+	// Through float, with printf and strtod.
+	vector<char> ftext(n*32);
+	size_t printed = 0;
+	t = best_time(3, [&]{
+		char* p = ftext.data();
+		for(size_t i = 0; i < n; i++){
+			p += sprintf(p, "%.9g\n", double(float(x[i])));
+		}
+		printed = size_t(p - ftext.data());
+	});
+	REPORT("sprintf of float " + name, double(printed), "B", t);
+
+	t = best_time(3, [&]{
+		const char* p = ftext.data();
+		char* e;
+		for(size_t i = 0; i < n; i++){
+			y[i] = T(strtod(p, &e));
+			p = e + 1;
+		}
+		checksum += y[n/2].num;
+	});
+	REPORT("strtod to float " + name, double(printed), "B", t);
+}
+
+void bench_decimal() {
+	bench_decimal_type<static_float::sf<15, -15>>("sf<15, -15>");
+	bench_decimal_type<static_float::sf<31, -16>>("sf<31, -16>");
+}
+
+void bench_round() {
+	using namespace static_float;
+
+	const size_t n = 1 << 20;
+	const uint reps = 20;
+	typedef sf<15, -8> T;
+	vector<T> x(n), c0(n), c1(n);
+	vector<typename rt::floor<T>::rt> fl(n);
+	vector<typename rt::round<T>::rt> ro(n);
+	vector<typename rt::fract<T>::rt> fr(n);
+	vector<usf<8, -8>> w(n);
+	vector<typename rt::mix<T, usf<8, -8>>::rt> mo(n);
+	vector<float> xf(n), yf(n);
+	for(size_t i = 0; i < n; i++){
+		x[i].num = int16_t(rand());
+		c0[i].num = int16_t(rand());
+		c1[i].num = int16_t(rand());
+		w[i].num = uint8_t(rand());
+		xf[i] = float(x[i]);
+	}
+
+	double t = best_time(reps, [&]{
+		floor(x.data(), fl.data(), n);
+		checksum += fl[n/2].num;
+		x[0].num ^= 1;
+	});
+	REPORT("floor sf<15, -8>", n, "elem", t);
+
+	t = best_time(reps, [&]{
+		round(x.data(), ro.data(), n);
+		checksum += ro[n/2].num;
+		x[0].num ^= 1;
+	});
+	REPORT("round sf<15, -8>", n, "elem", t);
+
+	t = best_time(reps, [&]{
+		fract(x.data(), fr.data(), n);
+		checksum += fr[n/2].num;
+		x[0].num ^= 1;
+	});
+	REPORT("fract sf<15, -8>", n, "elem", t);
+
+	const T lo(-10.0f), hi(10.0f);
+	t = best_time(reps, [&]{
+		clamp(x.data(), c0.data(), n, lo, hi);
+		checksum += c0[n/2].num;
+		x[0].num ^= 1;
+	});
+	REPORT("clamp sf<15, -8>", n, "elem", t);
+
+	t = best_time(reps, [&]{
+		mix(x.data(), c1.data(), w.data(), mo.data(), n);
+		checksum += mo[n/2].num;
+		x[0].num ^= 1;
+	});
+	REPORT("mix sf<15, -8>, usf<8, -8>", n, "elem", t);
+
+	// float with <cmath>.
+	t = best_time(reps, [&]{
+		for(size_t i = 0; i < n; i++){
+			yf[i] = std::floor(xf[i]);
+		}
+		checksum += int64_t(yf[n/2]);
+		xf[0] += 1;
+	});
+	REPORT("std::floor float", n, "elem", t);
+
+	t = best_time(reps, [&]{
+		for(size_t i = 0; i < n; i++){
+			yf[i] = std::round(xf[i]);
+		}
+		checksum += int64_t(yf[n/2]);
+		xf[0] += 1;
+	});
+	REPORT("std::round float", n, "elem", t);
+}
+
+void bench_scale_pow2() {
+	using namespace static_float;
+
+	const size_t n = 1 << 20;
+	const uint reps = 20;
+	typedef sf<15, -8> T;
+	vector<T> x(n), y(n);
+	vector<sf<16, -9>> mid(n);
+	vector<sf<16, -8>> mid_sh(n);
+	for(size_t i = 0; i < n; i++){
+		x[i].num = int16_t(rand());
+		y[i].num = int16_t(rand());
+	}
+
+	// (x + y)/2 by exponent, exact.
+	double t = best_time(reps, [&]{
+		for(size_t i = 0; i < n; i++){
+			mid[i] = scale_pow2<-1>(x[i] + y[i]);
+		}
+		checksum += mid[n/2].num;
+		x[0].num ^= 1;
+	});
+	REPORT("scale_pow2<-1>(x + y) sf<15, -8>", n, "elem", t);
+
+	// (x + y)/2 by shift of num, which loses low bit.
+	t = best_time(reps, [&]{
+		for(size_t i = 0; i < n; i++){
+			mid_sh[i].num = (x[i] + y[i]).num >> 1;
+		}
+		checksum += mid_sh[n/2].num;
+		x[0].num ^= 1;
+	});
+	REPORT("(x + y).num >> 1 sf<15, -8>", n, "elem", t);
+}
+
+void bench_bits() {
+	using namespace static_float;
+
+	const size_t n = 1 << 20;
+	const uint reps = 20;
+	typedef sf<15, -15> T;
+	vector<T> x(n), m(n);
+	vector<int> e(n);
+	for(size_t i = 0; i < n; i++){
+		x[i].num = int16_t(rand()) >> (rand() % 16);
+	}
+
+	double t = best_time(reps, [&]{
+		normalize_mantissa(x.data(), m.data(), e.data(), n);
+		checksum += m[n/2].num + e[n/2];
+		x[0].num ^= 1;
+	});
+	REPORT("normalize_mantissa batch sf<15, -15>", n, "elem", t);
+
+	t = best_time(reps, [&]{
+		for(size_t i = 0; i < n; i++){
+			auto r = normalize_mantissa(x[i]);
+			m[i] = r.m;
+			e[i] = r.e;
+		}
+		checksum += m[n/2].num + e[n/2];
+		x[0].num ^= 1;
+	});
+	REPORT("normalize_mantissa scalar sf<15, -15>", n, "elem", t);
+
+	// Shift loop, as it was done before clz.
+	t = best_time(reps, [&]{
+		for(size_t i = 0; i < n; i++){
+			int16_t v = x[i].num;
+			int ex = T::e + 15;
+			// Until bit 14 differs from sign bit.
+			for(int k = 0; k < 15 && int16_t(v ^ (v << 1)) >= 0; k++){
+				v = int16_t(v << 1);
+				ex--;
+			}
+			m[i].num = v;
+			e[i] = ex;
+		}
+		checksum += m[n/2].num + e[n/2];
+		x[0].num ^= 1;
+	});
+	REPORT("shift loop sf<15, -15>", n, "elem", t);
+
+	vector<usf<64, 0>> u(n);
+	for(size_t i = 0; i < n; i++){
+		u[i].num = (uint64_t(rand()) << 33 | uint64_t(rand())) >> (rand() % 64);
+	}
+	uint64_t sum = 0;
+	t = best_time(reps, [&]{
+		for(size_t i = 0; i < n; i++){
+			sum += clz(u[i]) + ctz(u[i]) + popcount(u[i]);
+		}
+		u[0].num ^= 1;
+	});
+	checksum += sum;
+	REPORT("clz + ctz + popcount usf<64, 0>", n, "elem", t);
+}
+
+void bench_block() {
+	using namespace static_float;
+
+	const size_t n = 1 << 16;
+	const uint reps = 50;
+	// Worst-case static type for 15 bits of precision in range of 2^40.
+	typedef sf<55, -35> T;
+	typedef sf_block_array<15, 32> A;
+	vector<float> xf(n), yf(n), zf(n);
+	vector<T> x(n), y(n);
+	vector<sf<56, -35>> zs(n);
+	vector<sf<111, -70>> ps(n);
+	for(size_t i = 0; i < n; i++){
+		// Range of block changes slowly, as in signals.
+		const int sh = int(i/1024 % 40);
+		x[i].num = int64_t(int16_t(rand()))*(int64_t(1) << sh);
+		y[i].num = int64_t(int16_t(rand()))*(int64_t(1) << (39 - sh));
+		xf[i] = float(x[i]);
+		yf[i] = float(y[i]);
+	}
+	A a, b, c;
+	a.assign(x.data(), n);
+	b.assign(y.data(), n);
+
+	double t = best_time(reps, [&]{
+		for(size_t i = 0; i < n; i++){
+			zf[i] = xf[i] + yf[i];
+		}
+		checksum += zf[n/2];
+		xf[0] += 1;
+	});
+	REPORT("add float", n, "elem", t);
+
+	t = best_time(reps, [&]{
+		for(size_t i = 0; i < n; i++){
+			zs[i] = x[i] + y[i];
+		}
+		checksum += zs[n/2].num;
+		x[0].num ^= 1;
+	});
+	REPORT("add sf<55, -35>", n, "elem", t);
+
+	t = best_time(reps, [&]{
+		add(a, b, c);
+		checksum += c.blocks[1].m[0];
+		a.blocks[0].m[0] ^= 1;
+	});
+	REPORT("add sf_block_array<15, 32>", n, "elem", t);
+
+	t = best_time(reps, [&]{
+		for(size_t i = 0; i < n; i++){
+			zf[i] = xf[i]*yf[i];
+		}
+		checksum += zf[n/2];
+		xf[0] += 1;
+	});
+	REPORT("mul float", n, "elem", t);
+
+	t = best_time(reps, [&]{
+		for(size_t i = 0; i < n; i++){
+			ps[i] = x[i]*y[i];
+		}
+		checksum += double(ps[n/2].num);
+		x[0].num ^= 1;
+	});
+	REPORT("mul sf<55, -35>", n, "elem", t);
+
+	t = best_time(reps, [&]{
+		mul(a, b, c);
+		checksum += c.blocks[1].m[0];
+		a.blocks[0].m[0] ^= 1;
+	});
+	REPORT("mul sf_block_array<15, 32>", n, "elem", t);
+
+	t = best_time(reps, [&]{
+		float s = 0;
+		for(size_t i = 0; i < n; i++){
+			s += xf[i]*yf[i];
+		}
+		checksum += s;
+		xf[0] += 1;
+	});
+	REPORT("dot float", n, "elem", t);
+
+	t = best_time(reps, [&]{
+		detail::int128_t s = 0;
+		for(size_t i = 0; i < n; i++){
+			s += (x[i]*y[i]).num;
+		}
+		checksum += double(s);
+		x[0].num ^= 1;
+	});
+	REPORT("dot sf<55, -35>", n, "elem", t);
+
+	t = best_time(reps, [&]{
+		auto p = dot(a, b);
+		checksum += p.m.num + p.e;
+		a.blocks[0].m[0] ^= 1;
+	});
+	REPORT("dot sf_block_array<15, 32>", n, "elem", t);
+
+	t = best_time(reps, [&]{
+		a.assign(x.data(), n);
+		checksum += a.blocks[1].m[0];
+		x[0].num ^= 1;
+	});
+	REPORT("assign sf<55, -35> to sf_block_array<15, 32>", n, "elem", t);
+
+	t = best_time(reps, [&]{
+		a.to(x.data());
+		checksum += x[n/2].num;
+		a.blocks[0].m[0] ^= 1;
+	});
+	REPORT("sf_block_array<15, 32> to sf<55, -35>", n, "elem", t);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+int main() {
+
+	bench_transform();
+	bench_gemm();
+	bench_nn();
+	bench_fir();
+	bench_iir();
+	bench_fft();
+	bench_complex();
+	bench_cordic();
+	bench_exp_log();
+	bench_lut();
+	bench_poly();
+	bench_accumulator();
+	bench_parallel();
+	bench_atomic();
+	bench_span();
+	bench_file();
+	bench_codec();
+	bench_decimal();
+	bench_round();
+	bench_scale_pow2();
+	bench_bits();
+	bench_block();
+
+	cout << "checksum = " << checksum << endl;
+
+	return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
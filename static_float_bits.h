@@ -0,0 +1,402 @@
+/**
+ * @file static_float_bits.h
+ * @date Oct 19, 2026
+ *
+ * @author Milos Subotic <milos.subotic.sm@gmail.com>
+ * @license MIT
+ *
+ * @brief Bit scan of static floats, clz, ctz, popcount and bit width,
+ * and normalization of mantissa with runtime exponent.
+ *
+ * @version 1.0
+ * Changelog:
+ * 1.0 - Initial version.
+ *
+ */
+
+#ifndef STATIC_FLOAT_BITS_H_
+#define STATIC_FLOAT_BITS_H_
+
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <cstring>
+
+#include "static_float.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+namespace static_float {
+
+	/**
+	 * @class sf_normalized
+	 * @brief Static float M with runtime exponent, of value m*2^e.
+	 * @param M mantissa type, sf<B, -B> or usf<B, -B>
+	 */
+	template<typename M>
+	struct sf_normalized {
+		M m;
+		int e;
+	};
+
+	namespace detail {
+
+		template<uint S>
+		struct uint_of_size;
+
+		template<>
+		struct uint_of_size<1> {
+			typedef uint8_t type;
+		};
+
+		template<>
+		struct uint_of_size<2> {
+			typedef uint16_t type;
+		};
+
+		template<>
+		struct uint_of_size<4> {
+			typedef uint32_t type;
+		};
+
+		template<>
+		struct uint_of_size<8> {
+			typedef uint64_t type;
+		};
+
+		template<>
+		struct uint_of_size<16> {
+			typedef uint128_t type;
+		};
+
+		/**
+		 * Bit scan of unsigned U with builtins, which are lzcnt, tzcnt
+		 * and popcnt instructions where there are ones.
+		 * Conditions for zero are folded to them or to cmov.
+		 */
+		template<typename U, uint S = (sizeof(U) <= 4 ? 4 : sizeof(U))>
+		struct bit_ops {
+			static uint width(U u) {
+				return u ? 32 - __builtin_clz(uint32_t(u)) : 0;
+			}
+
+			/**
+			 * Width from exponent of float(u), which is exact for up to
+			 * 24 bits. Conversion to float is vectorized, and clz is not.
+			 */
+			static uint width_vec(U u) {
+				if(sizeof(U) > 2){
+					return width(u);
+				}
+				const float f = float(u);
+				uint32_t bits;
+				std::memcpy(&bits, &f, sizeof(bits));
+				const int w = int(bits >> 23) - 126;
+				return uint(w < 0 ? 0 : w);
+			}
+
+			static uint ctz(U u, uint z) {
+				return u ? __builtin_ctz(uint32_t(u)) : z;
+			}
+
+			static uint popcount(U u) {
+				return __builtin_popcount(uint32_t(u));
+			}
+		};
+
+		template<typename U>
+		struct bit_ops<U, 8> {
+			static uint width(U u) {
+				return u ? 64 - __builtin_clzll(u) : 0;
+			}
+
+			static uint width_vec(U u) {
+				return width(u);
+			}
+
+			static uint ctz(U u, uint z) {
+				return u ? __builtin_ctzll(u) : z;
+			}
+
+			static uint popcount(U u) {
+				return __builtin_popcountll(u);
+			}
+		};
+
+		template<typename U>
+		struct bit_ops<U, 16> {
+			typedef bit_ops<uint64_t> half;
+
+			static uint width(U u) {
+				const uint64_t hi = uint64_t(u >> 64);
+				return hi ? 64 + half::width(hi) : half::width(uint64_t(u));
+			}
+
+			static uint width_vec(U u) {
+				return width(u);
+			}
+
+			static uint ctz(U u, uint z) {
+				const uint64_t lo = uint64_t(u);
+				return lo
+					? half::ctz(lo, 0)
+					: half::ctz(uint64_t(u >> 64), z - 64) + 64;
+			}
+
+			static uint popcount(U u) {
+				return half::popcount(uint64_t(u))
+					+ half::popcount(uint64_t(u >> 64));
+			}
+		};
+
+		/**
+		 * Bit scan of num N, signed or unsigned.
+		 * Negative nums are scanned as ~num, which have same bits as
+		 * magnitude, without redundant sign bits.
+		 */
+		template<typename N>
+		struct num_bits {
+			typedef typename uint_of_size<sizeof(N)>::type U;
+			typedef bit_ops<U> ops;
+
+			static U sign_free(const N& n) {
+				return U(n < 0 ? N(~n) : n);
+			}
+
+			static uint width(const N& n) {
+				return ops::width(sign_free(n));
+			}
+
+			static uint width_vec(const N& n) {
+				return ops::width_vec(sign_free(n));
+			}
+
+			static uint ctz(const N& n, uint z) {
+				return ops::ctz(U(n), z);
+			}
+
+			/// Of magnitude.
+			static uint popcount(const N& n) {
+				return ops::popcount(n < 0 ? U(U(0) - U(n)) : U(n));
+			}
+
+			/**
+			 * Shift is done unsigned, so it is defined for negative nums.
+			 * Shift for all bits of U is only for 0, and it is masked.
+			 */
+			static N shl(const N& n, uint s) {
+				return N(U(U(n) << (s & (8*sizeof(U) - 1))));
+			}
+		};
+
+#ifdef HAVE_GMP
+		template<typename N>
+		struct num_bits_big {
+			static uint width(const N& n) {
+				if(sgn(n) == 0){
+					return 0;
+				}
+				mpz_class m;
+				mpz_com(m.get_mpz_t(), n.get_mpz_t());
+				const mpz_class& s = sgn(n) < 0 ? m : static_cast<const mpz_class&>(n);
+				return sgn(s) == 0 ? 0 : uint(mpz_sizeinbase(s.get_mpz_t(), 2));
+			}
+
+			static uint width_vec(const N& n) {
+				return width(n);
+			}
+
+			static uint ctz(const N& n, uint z) {
+				return sgn(n) == 0 ? z : uint(mpz_scan1(n.get_mpz_t(), 0));
+			}
+
+			static uint popcount(const N& n) {
+				mpz_class m;
+				mpz_abs(m.get_mpz_t(), n.get_mpz_t());
+				return uint(mpz_popcount(m.get_mpz_t()));
+			}
+
+			static N shl(const N& n, uint s) {
+				return N(n << s);
+			}
+		};
+
+		template<>
+		struct num_bits<int_big_t> : num_bits_big<int_big_t> {
+		};
+
+		template<>
+		struct num_bits<uint_big_t> : num_bits_big<uint_big_t> {
+		};
+#endif
+
+		template<typename T>
+		typename rt::normalize_mantissa<T>::rt normalize_mantissa_impl(
+			const T& x,
+			uint w
+		) {
+			typedef detail::num_bits<typename T::num_type> nb;
+			const uint s = T::b - w;
+			typename rt::normalize_mantissa<T>::rt r;
+			r.m.num = nb::shl(x.num, s);
+			r.e = T::e + int(w);
+			return r;
+		}
+
+	} // namespace detail
+
+	////////////////////////////////////
+
+} // namespace static_float
+
+
+namespace rt {
+
+	/**
+	 * Mantissa have same bits as argument and no integer bits.
+	 */
+	template<uint B, int E>
+	struct normalize_mantissa<static_float::sf<B, E>> {
+		typedef static_float::sf_normalized<static_float::sf<B, -int(B)>> rt;
+	};
+
+	template<uint B, int E>
+	struct normalize_mantissa<static_float::usf<B, E>> {
+		typedef static_float::sf_normalized<static_float::usf<B, -int(B)>> rt;
+	};
+
+} // namespace rt
+
+
+namespace static_float {
+
+	/**
+	 * Count of significant bits of num, 0 for 0.
+	 * Sign bit of sf is not counted and negative num is counted as ~num,
+	 * as for two's complement normalization, so it is in [0, B].
+	 */
+	template<uint B, int E>
+	uint bit_width(const sf<B, E>& x) {
+		return detail::num_bits<typename sf<B, E>::num_type>::width(x.num);
+	}
+
+	template<uint B, int E>
+	uint bit_width(const usf<B, E>& x) {
+		return detail::num_bits<typename usf<B, E>::num_type>::width(x.num);
+	}
+
+	/**
+	 * Leading zeros of B bits of num, or redundant sign bits for sf.
+	 * It is B for 0.
+	 */
+	template<uint B, int E>
+	uint clz(const sf<B, E>& x) {
+		return B - bit_width(x);
+	}
+
+	template<uint B, int E>
+	uint clz(const usf<B, E>& x) {
+		return B - bit_width(x);
+	}
+
+	/**
+	 * Index of highest significant bit of num, -1 for 0.
+	 * Value of that bit is 2^(msb_index(x) + E).
+	 */
+	template<uint B, int E>
+	int msb_index(const sf<B, E>& x) {
+		return int(bit_width(x)) - 1;
+	}
+
+	template<uint B, int E>
+	int msb_index(const usf<B, E>& x) {
+		return int(bit_width(x)) - 1;
+	}
+
+	/**
+	 * Trailing zeros of num, B for 0.
+	 */
+	template<uint B, int E>
+	uint ctz(const sf<B, E>& x) {
+		return detail::num_bits<typename sf<B, E>::num_type>::ctz(x.num, B);
+	}
+
+	template<uint B, int E>
+	uint ctz(const usf<B, E>& x) {
+		return detail::num_bits<typename usf<B, E>::num_type>::ctz(x.num, B);
+	}
+
+	/**
+	 * Set bits of magnitude of num.
+	 */
+	template<uint B, int E>
+	uint popcount(const sf<B, E>& x) {
+		return detail::num_bits<typename sf<B, E>::num_type>::popcount(x.num);
+	}
+
+	template<uint B, int E>
+	uint popcount(const usf<B, E>& x) {
+		return detail::num_bits<typename usf<B, E>::num_type>::popcount(x.num);
+	}
+
+	////////////////////////////////////
+
+	/**
+	 * Shift num left for clz(x), so x = m*2^e, with mantissa m
+	 * in [0.5, 1) for usf, and in [-1, -0.5) or [0.5, 1) for sf.
+	 * For x == 0, m is 0 and e is E.
+	 * Usage: auto n = normalize_mantissa(x); n.m*n.m is in [0.25, 1).
+	 */
+	template<uint B, int E>
+	typename rt::normalize_mantissa<sf<B, E>>::rt
+	normalize_mantissa(const sf<B, E>& x) {
+		return detail::normalize_mantissa_impl(x, bit_width(x));
+	}
+
+	template<uint B, int E>
+	typename rt::normalize_mantissa<usf<B, E>>::rt
+	normalize_mantissa(const usf<B, E>& x) {
+		return detail::normalize_mantissa_impl(x, bit_width(x));
+	}
+
+	/**
+	 * Batch version, with mantissas and exponents in separate arrays,
+	 * which is vectorized for nums of up to 16 bits.
+	 */
+	template<uint B, int E>
+	void normalize_mantissa(
+		const sf<B, E>* __restrict in,
+		sf<B, -int(B)>* __restrict m,
+		int* __restrict e,
+		size_t n
+	) {
+		typedef detail::num_bits<typename sf<B, E>::num_type> nb;
+		for(size_t i = 0; i < n; i++){
+			const uint w = nb::width_vec(in[i].num);
+			m[i].num = nb::shl(in[i].num, B - w);
+			e[i] = E + int(w);
+		}
+	}
+
+	template<uint B, int E>
+	void normalize_mantissa(
+		const usf<B, E>* __restrict in,
+		usf<B, -int(B)>* __restrict m,
+		int* __restrict e,
+		size_t n
+	) {
+		typedef detail::num_bits<typename usf<B, E>::num_type> nb;
+		for(size_t i = 0; i < n; i++){
+			const uint w = nb::width_vec(in[i].num);
+			m[i].num = nb::shl(in[i].num, B - w);
+			e[i] = E + int(w);
+		}
+	}
+
+	////////////////////////////////////
+
+} // namespace static_float
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // STATIC_FLOAT_BITS_H_
@@ -0,0 +1,398 @@
+/**
+ * @file static_float_block.h
+ * @date Oct 19, 2026
+ *
+ * @author Milos Subotic <milos.subotic.sm@gmail.com>
+ * @license MIT
+ *
+ * @brief Block floating point, arrays of sf<B, 0> nums with one runtime
+ * exponent per block of N elements.
+ *
+ * @version 1.0
+ * Changelog:
+ * 1.0 - Initial version.
+ *
+ */
+
+#ifndef STATIC_FLOAT_BLOCK_H_
+#define STATIC_FLOAT_BLOCK_H_
+
+///////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+#include <climits>
+#include <cassert>
+
+#include "static_float_bits.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+namespace static_float {
+
+	/**
+	 * @class sf_block
+	 * @brief N nums of sf<B, 0> with shared exponent,
+	 * element i have value m[i]*2^e.
+	 * Block is normalized when some m[i] have bit width B,
+	 * or when all are 0 and e is zero_e, which is below any other exponent,
+	 * so such block is absorbed in addition.
+	 * @param B bits of mantissa without sign, at most 31
+	 * @param N count of elements in block
+	 */
+	template<uint B, uint N = 32>
+	struct sf_block {
+		static_assert(B >= 1 && B <= 31, "Mantissa must have 1 to 31 bits!");
+		static_assert(N >= 1, "Block is empty!");
+
+		typedef typename sf<B, 0>::num_type num_type;
+		/// Holds product of two nums, and sum of them with B - 1 guard bits.
+		typedef typename sf<2*B + 1, 0>::num_type wide_type;
+
+		static constexpr uint b = B;
+		static constexpr uint n = N;
+		static constexpr int zero_e = INT_MIN/4;
+
+		num_type m[N];
+		int e;
+	};
+
+	namespace detail {
+
+		/**
+		 * Normalize N wide nums v with exponent ev to block r.
+		 * All nums are shifted for bit width of largest magnitude,
+		 * found from OR of sign free nums, so loops are vectorized.
+		 * Rounding is to nearest and it is saturated at 2^B - 1.
+		 */
+		template<uint B, uint N, typename W>
+		void block_pack(const W* v, int ev, sf_block<B, N>& r) {
+			typedef typename sf_block<B, N>::num_type num_type;
+			typedef num_bits<W> nb;
+			typename nb::U o = 0;
+			for(uint i = 0; i < N; i++){
+				o |= nb::sign_free(v[i]);
+			}
+			const uint w = nb::ops::width(o);
+			if(w == 0){
+				for(uint i = 0; i < N; i++){
+					r.m[i] = 0;
+				}
+				r.e = sf_block<B, N>::zero_e;
+			}else if(w <= B){
+				const uint s = B - w;
+				for(uint i = 0; i < N; i++){
+					r.m[i] = num_type(nb::shl(v[i], s));
+				}
+				r.e = ev - int(s);
+			}else{
+				// Halves are rounded up without overflow of W.
+				const uint s = w - B;
+				const W max = (W(1) << B) - 1;
+				for(uint i = 0; i < N; i++){
+					const W q = ((v[i] >> (s - 1)) + 1) >> 1;
+					r.m[i] = num_type(q > max ? max : q);
+				}
+				r.e = ev + int(s);
+			}
+		}
+
+		/**
+		 * Block of count elements of static floats x, rest are 0.
+		 */
+		template<uint B, uint N, typename T>
+		void block_from(const T* x, uint count, sf_block<B, N>& r) {
+			static_assert(T::b <= 126, "Static float is too wide!");
+			typedef typename sf<T::b + 1, 0>::num_type W;
+			W v[N];
+			for(uint i = 0; i < N; i++){
+				v[i] = i < count ? W(x[i].num) : W(0);
+			}
+			block_pack(v, T::e, r);
+		}
+
+		/**
+		 * Count elements of block x to static floats,
+		 * rounded to nearest and saturated.
+		 */
+		template<uint B, uint N, typename T>
+		void block_to(const sf_block<B, N>& x, T* out, uint count) {
+			constexpr bool t_signed = is_signed_type((T*)nullptr);
+			typedef typename sf<rt::max(B + 1, T::b), 0>::num_type W;
+			typedef typename T::num_type TN;
+			const W max = W((W(1) << (T::b - 1)) - 1 + (W(1) << (T::b - 1)));
+			const W min = t_signed ? W(-max - 1) : W(0);
+			const int sh = x.e - T::e;
+			if(sh >= 0){
+				// Saturate before shift left, so that it cannot overflow.
+				const uint s = uint(sh) < T::b ? uint(sh) : T::b;
+				const W lmax = max >> s;
+				const W lmin = min >> s;
+				const W k = W(1) << s;
+				for(uint i = 0; i < count; i++){
+					const W v = W(x.m[i]);
+					out[i].num = TN(v > lmax ? max : v < lmin ? min : W(v*k));
+				}
+			}else{
+				// Tiny nums are rounded to 0 for shift of B + 1.
+				const uint s = uint(-sh) < B + 1 ? uint(-sh) : B + 1;
+				for(uint i = 0; i < count; i++){
+					const W q = ((W(x.m[i]) >> (s - 1)) + 1) >> 1;
+					out[i].num = TN(q > max ? max : q < min ? min : q);
+				}
+			}
+		}
+
+		/**
+		 * Block with larger exponent is taken with B - 1 guard bits,
+		 * and other one is aligned to it by shift right.
+		 */
+		template<uint B, uint N>
+		void block_add(
+			const sf_block<B, N>& x,
+			const sf_block<B, N>& y,
+			sf_block<B, N>& r
+		) {
+			typedef typename sf_block<B, N>::wide_type W;
+			const sf_block<B, N>& hi = x.e >= y.e ? x : y;
+			const sf_block<B, N>& lo = x.e >= y.e ? y : x;
+			const uint d = uint(hi.e - lo.e);
+			const uint g = d < B - 1 ? d : B - 1;
+			const uint ws = 8*sizeof(W) - 1;
+			const uint s = d - g < ws ? d - g : ws;
+			const W k = W(1) << g;
+			W v[N];
+			for(uint i = 0; i < N; i++){
+				v[i] = W(hi.m[i])*k + (W(lo.m[i]) >> s);
+			}
+			block_pack(v, hi.e - int(g), r);
+		}
+
+		template<uint B, uint N>
+		void block_mul(
+			const sf_block<B, N>& x,
+			const sf_block<B, N>& y,
+			sf_block<B, N>& r
+		) {
+			typedef typename sf_block<B, N>::wide_type W;
+			W v[N];
+			for(uint i = 0; i < N; i++){
+				v[i] = W(x.m[i])*W(y.m[i]);
+			}
+			block_pack(v, x.e + y.e, r);
+		}
+
+	} // namespace detail
+
+	////////////////////////////////////
+
+	/**
+	 * @class sf_block_array
+	 * @brief Array of block floating point numbers.
+	 * Mantissas are narrow as sf<B, 0>, so kernels work on int16 lanes
+	 * for B = 15, while range is as of float because of block exponents.
+	 * Precision of small elements is lost in block with large ones.
+	 * @param B bits of mantissa without sign
+	 * @param N count of elements in block
+	 */
+	template<uint B, uint N = 32>
+	class sf_block_array {
+	public:
+		typedef sf_block<B, N> block_type;
+		typedef sf_normalized<sf<B, -int(B)>> value_type;
+
+		std::vector<block_type> blocks;
+
+		////////////////////////////////
+
+	private:
+		size_t count;
+
+	public:
+		sf_block_array()
+			: count(0) {
+		}
+
+		explicit sf_block_array(size_t n)
+			: count(0) {
+			resize(n);
+		}
+
+		size_t size() const {
+			return count;
+		}
+
+		/**
+		 * New elements are 0.
+		 */
+		void resize(size_t n) {
+			block_type z;
+			for(uint i = 0; i < N; i++){
+				z.m[i] = 0;
+			}
+			z.e = block_type::zero_e;
+			blocks.resize((n + N - 1)/N, z);
+			count = n;
+		}
+
+		////////////////////////////////
+
+	public:
+		/**
+		 * Element i as mantissa and exponent, without normalization.
+		 */
+		value_type get(size_t i) const {
+			const block_type& k = blocks[i/N];
+			value_type r;
+			r.m.num = k.m[i%N];
+			r.e = k.e + int(B);
+			return r;
+		}
+
+		/**
+		 * Load n static floats, ie. worst-case types.
+		 * Every block gets exponent of its largest element.
+		 */
+		template<typename T>
+		void assign(const T* x, size_t n) {
+			resize(n);
+			for(size_t k = 0; k < blocks.size(); k++){
+				const size_t rest = n - k*N;
+				detail::block_from(
+					x + k*N,
+					uint(rest < N ? rest : N),
+					blocks[k]
+				);
+			}
+		}
+
+		/**
+		 * Store all elements to static floats,
+		 * rounded to nearest and saturated.
+		 */
+		template<typename T>
+		void to(T* out) const {
+			for(size_t k = 0; k < blocks.size(); k++){
+				const size_t rest = count - k*N;
+				detail::block_to(
+					blocks[k],
+					out + k*N,
+					uint(rest < N ? rest : N)
+				);
+			}
+		}
+
+		/**
+		 * Normalize all blocks, ie. after mantissas were changed directly.
+		 */
+		void renormalize() {
+			for(size_t k = 0; k < blocks.size(); k++){
+				detail::block_pack(blocks[k].m, blocks[k].e, blocks[k]);
+			}
+		}
+
+		////////////////////////////////
+
+	};
+
+	/**
+	 * Element wise out[i] = x[i] + y[i], out could be x or y.
+	 */
+	template<uint B, uint N>
+	void add(
+		const sf_block_array<B, N>& x,
+		const sf_block_array<B, N>& y,
+		sf_block_array<B, N>& out
+	) {
+		assert(x.size() == y.size());
+		out.resize(x.size());
+		for(size_t k = 0; k < out.blocks.size(); k++){
+			detail::block_add(x.blocks[k], y.blocks[k], out.blocks[k]);
+		}
+	}
+
+	/**
+	 * Element wise out[i] = x[i]*y[i], out could be x or y.
+	 */
+	template<uint B, uint N>
+	void mul(
+		const sf_block_array<B, N>& x,
+		const sf_block_array<B, N>& y,
+		sf_block_array<B, N>& out
+	) {
+		assert(x.size() == y.size());
+		out.resize(x.size());
+		for(size_t k = 0; k < out.blocks.size(); k++){
+			detail::block_mul(x.blocks[k], y.blocks[k], out.blocks[k]);
+		}
+	}
+
+	/**
+	 * Sum of x[i]*y[i], with mantissa of product precision.
+	 * Sums of blocks are exact, and they are aligned to largest one
+	 * in 126 bits, with guard bits for 2^32 blocks.
+	 */
+	template<uint B, uint N>
+	sf_normalized<sf<2*B + 1, -int(2*B + 1)>> dot(
+		const sf_block_array<B, N>& x,
+		const sf_block_array<B, N>& y
+	) {
+		constexpr uint P = 2*B + 1;
+		// Bits of sum of block with sign.
+		constexpr uint pb = 2*B + detail::ceil_log2(N) + 2;
+		static_assert(pb + 32 < 126, "Block is too long!");
+		constexpr uint G = 126 - 32 - pb;
+		typedef typename sf<pb - 1, 0>::num_type pt;
+		typedef detail::int128_t wt;
+		typedef detail::num_bits<wt> nb;
+		assert(x.size() == y.size());
+
+		const size_t nk = x.blocks.size();
+		int emax = INT_MIN;
+		for(size_t k = 0; k < nk; k++){
+			const int ek = x.blocks[k].e + y.blocks[k].e;
+			emax = ek > emax ? ek : emax;
+		}
+
+		wt acc = 0;
+		for(size_t k = 0; k < nk; k++){
+			const sf_block<B, N>& a = x.blocks[k];
+			const sf_block<B, N>& b = y.blocks[k];
+			pt p = 0;
+			for(uint i = 0; i < N; i++){
+				p += pt(a.m[i])*pt(b.m[i]);
+			}
+			const uint d = uint(emax - (a.e + b.e));
+			if(d <= G){
+				acc += wt(p)*(wt(1) << (G - d));
+			}else{
+				acc += wt(p) >> (d - G < 127 ? d - G : 127);
+			}
+		}
+
+		sf_normalized<sf<P, -int(P)>> r;
+		const uint w = nb::width(acc);
+		if(w == 0){
+			r.m.num = 0;
+			r.e = 0;
+			return r;
+		}
+		typedef typename sf<P, 0>::num_type mt;
+		if(w <= P){
+			r.m.num = mt(nb::shl(acc, P - w));
+		}else{
+			const uint s = w - P;
+			const wt max = (wt(1) << P) - 1;
+			const wt q = ((acc >> (s - 1)) + 1) >> 1;
+			r.m.num = mt(q > max ? max : q);
+		}
+		r.e = emax - int(G) + int(w);
+		return r;
+	}
+
+	////////////////////////////////////
+
+} // namespace static_float
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // STATIC_FLOAT_BLOCK_H_
@@ -0,0 +1,619 @@
+/**
+ * @file static_float_codec.h
+ * @date Oct 19, 2026
+ *
+ * @author Milos Subotic <milos.subotic.sm@gmail.com>
+ * @license MIT
+ *
+ * @brief Lossless compression of static float series.
+ *
+ * Series is coded in blocks of 128 elements, last one could be shorter.
+ * Every block is coded on its own, with one of:
+ *  order 0, frame of reference: num - min,
+ *  order 1, delta: zigzag(num[i] - num[i-1]) - min,
+ *  order 2, delta of delta: zigzag(delta[i] - delta[i-1]) - min,
+ * whichever have least bits, so slow changing samples of sensors
+ * are coded with few bits per element.
+ * Layout of block:
+ *  uint8 order, with 4 added for short block
+ *  uint8 bits w of packed elements
+ *  varint count of elements, only for short block
+ *  varint zigzag of first num, for order 1 and 2
+ *  varint zigzag of first delta, for order 2
+ *  varint min, zigzag of it for order 0
+ *  count - order elements packed in w bits, least significant bits first
+ * Varints are 7 bits per byte, least significant first.
+ *
+ * @version 1.0
+ * Changelog:
+ * 1.0 - Initial version.
+ *
+ */
+
+#ifndef STATIC_FLOAT_CODEC_H_
+#define STATIC_FLOAT_CODEC_H_
+
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstring>
+#include <vector>
+#include <type_traits>
+
+#include "static_float.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+namespace static_float {
+
+	namespace detail {
+
+		/// Elements of block, multiple of 8, so packed groups are whole bytes.
+		constexpr uint codec_block = 128;
+		/// Bytes which unpack could read after packed elements.
+		constexpr uint codec_slack = 8;
+		constexpr uint codec_max_block_bytes = 2 + 4*10 + codec_block*8;
+
+		inline uint64_t load_le64(const uint8_t* p) {
+			uint64_t v;
+			memcpy(&v, p, 8);
+#if __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+			v = __builtin_bswap64(v);
+#endif
+			return v;
+		}
+
+		inline void store_le64(uint8_t* p, uint64_t v) {
+#if __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+			v = __builtin_bswap64(v);
+#endif
+			memcpy(p, &v, 8);
+		}
+
+		inline uint64_t zigzag(uint64_t v) {
+			return (v << 1) ^ uint64_t(int64_t(v) >> 63);
+		}
+
+		inline uint64_t unzigzag(uint64_t u) {
+			return (u >> 1) ^ (0 - (u & 1));
+		}
+
+		inline uint codec_width(uint64_t v) {
+			return v ? 64 - __builtin_clzll(v) : 0;
+		}
+
+		inline void put_varint(uint8_t*& p, uint64_t v) {
+			while(v >= 0x80){
+				*p++ = uint8_t(v | 0x80);
+				v >>= 7;
+			}
+			*p++ = uint8_t(v);
+		}
+
+		/**
+		 * @return false if varint doesn't end before end
+		 */
+		inline bool get_varint(const uint8_t*& p, const uint8_t* end, uint64_t& v) {
+			v = 0;
+			for(uint s = 0; p < end && s < 64; s += 7){
+				const uint8_t b = *p++;
+				v |= uint64_t(b & 0x7f) << s;
+				if(!(b & 0x80)){
+					return true;
+				}
+			}
+			return false;
+		}
+
+		/**
+		 * Pack n elements of w bits to (n*w + 7)/8 bytes.
+		 */
+		inline void codec_pack(const uint64_t* in, uint n, uint w, uint8_t* out) {
+			if(w == 64){
+				for(uint i = 0; i < n; i++){
+					store_le64(out + 8*i, in[i]);
+				}
+				return;
+			}
+			uint64_t acc = 0;
+			uint fill = 0;
+			for(uint i = 0; i < n; i++){
+				const uint64_t v = in[i];
+				acc |= v << fill;
+				fill += w;
+				if(fill >= 64){
+					store_le64(out, acc);
+					out += 8;
+					fill -= 64;
+					// Bits of v which didn't fit.
+					acc = fill ? v >> (w - fill) : 0;
+				}
+			}
+			for(uint i = 0; i < fill; i += 8){
+				*out++ = uint8_t(acc >> i);
+			}
+		}
+
+		/**
+		 * Element j of group of 8 elements of W bits, which are W bytes.
+		 */
+		template<uint W, uint J>
+		inline uint64_t codec_get(const uint8_t* g) {
+			constexpr uint bit = J*W;
+			constexpr uint s = bit % 8;
+			constexpr uint64_t mask = W == 64 ? ~uint64_t(0) : (uint64_t(1) << W) - 1;
+			uint64_t v = load_le64(g + bit/8) >> s;
+			if(s + W > 64){
+				v |= uint64_t(g[bit/8 + 8]) << (64 - s);
+			}
+			return v & mask;
+		}
+
+		/**
+		 * Unpack n elements of W bits,
+		 * reading up to codec_slack bytes after them.
+		 * Groups of 8 elements have all shifts constant.
+		 */
+		template<uint W>
+		void codec_unpack(const uint8_t* in, uint n, uint64_t* out) {
+			if(W == 0){
+				for(uint i = 0; i < n; i++){
+					out[i] = 0;
+				}
+				return;
+			}
+			uint i = 0;
+			for(; i + 8 <= n; i += 8, in += W){
+				out[i + 0] = codec_get<W, 0>(in);
+				out[i + 1] = codec_get<W, 1>(in);
+				out[i + 2] = codec_get<W, 2>(in);
+				out[i + 3] = codec_get<W, 3>(in);
+				out[i + 4] = codec_get<W, 4>(in);
+				out[i + 5] = codec_get<W, 5>(in);
+				out[i + 6] = codec_get<W, 6>(in);
+				out[i + 7] = codec_get<W, 7>(in);
+			}
+			// Tail with shifts in runtime, not to read past slack.
+			constexpr uint64_t mask = W == 64 ? ~uint64_t(0) : (uint64_t(1) << W) - 1;
+			for(uint bit = 0; i < n; i++, bit += W){
+				const uint s = bit % 8;
+				uint64_t v = load_le64(in + bit/8) >> s;
+				if(s + W > 64){
+					v |= uint64_t(in[bit/8 + 8]) << (64 - s);
+				}
+				out[i] = v & mask;
+			}
+		}
+
+		typedef void (*codec_unpack_fn)(const uint8_t*, uint, uint64_t*);
+
+		template<typename S>
+		struct codec_unpackers;
+
+		template<uint... I>
+		struct codec_unpackers<index_seq<I...>> {
+			static const codec_unpack_fn fn[sizeof...(I)];
+		};
+
+		template<uint... I>
+		const codec_unpack_fn codec_unpackers<index_seq<I...>>::fn[sizeof...(I)]
+			= { codec_unpack<I>... };
+
+		/// Unpacker for bits 0 to 64.
+		typedef codec_unpackers<make_index_seq<65>::type> codec_unpack_table;
+
+		/**
+		 * Parsed header of block.
+		 */
+		struct codec_header {
+			uint order;
+			uint w;
+			uint n;
+			uint64_t first;
+			uint64_t first_delta;
+			uint64_t ref;
+			/// Packed elements.
+			const uint8_t* packed;
+			/// Next block.
+			const uint8_t* next;
+
+			/**
+			 * @return false if block is not valid or doesn't end before end
+			 */
+			bool parse(const uint8_t* p, const uint8_t* end) {
+				if(end - p < 2){
+					return false;
+				}
+				order = p[0] & 3;
+				const bool short_block = p[0] & 4;
+				w = p[1];
+				p += 2;
+				uint64_t c = codec_block;
+				if(short_block && (!get_varint(p, end, c) || c >= codec_block)){
+					return false;
+				}
+				n = uint(c);
+				if(
+					order > 2 || w > 64 || n == 0 || n <= order
+					|| (order >= 1 && !get_varint(p, end, first))
+					|| (order == 2 && !get_varint(p, end, first_delta))
+					|| !get_varint(p, end, ref)
+				){
+					return false;
+				}
+				const size_t bytes = (size_t(n - order)*w + 7)/8;
+				if(size_t(end - p) < bytes){
+					return false;
+				}
+				packed = p;
+				next = p + bytes;
+				return true;
+			}
+		};
+
+		/**
+		 * Code n <= codec_block elements x to out,
+		 * which have room for codec_max_block_bytes.
+		 * @return bytes of block
+		 */
+		template<typename T>
+		size_t codec_encode_block(const T* x, uint n, uint8_t* out) {
+			uint64_t v[codec_block];
+			uint64_t r[3][codec_block];
+			for(uint i = 0; i < n; i++){
+				v[i] = uint64_t(int64_t(x[i].num));
+			}
+			// Residuals of all orders, with their ranges.
+			uint64_t lo[3] = {~uint64_t(0), ~uint64_t(0), ~uint64_t(0)};
+			uint64_t hi[3] = {0, 0, 0};
+			for(uint i = 0; i < n; i++){
+				// Order 0 in offset binary, so that it is ordered as unsigned.
+				r[0][i] = v[i] ^ (uint64_t(1) << 63);
+				lo[0] = r[0][i] < lo[0] ? r[0][i] : lo[0];
+				hi[0] = r[0][i] > hi[0] ? r[0][i] : hi[0];
+			}
+			for(uint i = 1; i < n; i++){
+				r[1][i - 1] = zigzag(v[i] - v[i - 1]);
+				lo[1] = r[1][i - 1] < lo[1] ? r[1][i - 1] : lo[1];
+				hi[1] = r[1][i - 1] > hi[1] ? r[1][i - 1] : hi[1];
+			}
+			for(uint i = 2; i < n; i++){
+				r[2][i - 2] = zigzag(v[i] - 2*v[i - 1] + v[i - 2]);
+				lo[2] = r[2][i - 2] < lo[2] ? r[2][i - 2] : lo[2];
+				hi[2] = r[2][i - 2] > hi[2] ? r[2][i - 2] : hi[2];
+			}
+			uint order = 0;
+			uint w = codec_width(hi[0] - lo[0]);
+			for(uint o = 1; o <= 2 && o < n; o++){
+				const uint wo = codec_width(hi[o] - lo[o]);
+				if(wo < w){
+					order = o;
+					w = wo;
+				}
+			}
+
+			uint8_t* p = out;
+			*p++ = uint8_t(order | (n < codec_block ? 4 : 0));
+			*p++ = uint8_t(w);
+			if(n < codec_block){
+				put_varint(p, n);
+			}
+			if(order >= 1){
+				put_varint(p, zigzag(v[0]));
+			}
+			if(order == 2){
+				put_varint(p, zigzag(v[1] - v[0]));
+			}
+			const uint m = n - order;
+			uint64_t* ro = r[order];
+			const uint64_t ref = lo[order];
+			put_varint(p, order == 0 ? zigzag(ref ^ (uint64_t(1) << 63)) : ref);
+			for(uint i = 0; i < m; i++){
+				ro[i] -= ref;
+			}
+			codec_pack(ro, m, w, p);
+			return size_t(p - out) + (size_t(m)*w + 7)/8;
+		}
+
+		/**
+		 * Decode block of header h to out.
+		 * @param end end of buffer, to know if unpack could read past block
+		 */
+		template<typename T>
+		void codec_decode_block(
+			const codec_header& h,
+			const uint8_t* end,
+			T* __restrict out
+		) {
+			typedef typename T::num_type nt;
+			const uint m = h.n - h.order;
+			const uint8_t* src = h.packed;
+			uint8_t tmp[codec_block*8 + codec_slack];
+			if(size_t(end - h.next) < codec_slack){
+				memcpy(tmp, h.packed, size_t(h.next - h.packed));
+				src = tmp;
+			}
+			uint64_t r[codec_block];
+			codec_unpack_table::fn[h.w](src, m, r);
+			const uint64_t ref = h.ref;
+			if(h.order == 0){
+				const uint64_t min = unzigzag(ref);
+				for(uint i = 0; i < m; i++){
+					out[i].num = nt(int64_t(r[i] + min));
+				}
+			}else if(h.order == 1){
+				uint64_t x = unzigzag(h.first);
+				out[0].num = nt(int64_t(x));
+				for(uint i = 0; i < m; i++){
+					x += unzigzag(r[i] + ref);
+					out[i + 1].num = nt(int64_t(x));
+				}
+			}else{
+				uint64_t x = unzigzag(h.first);
+				uint64_t d = unzigzag(h.first_delta);
+				out[0].num = nt(int64_t(x));
+				x += d;
+				out[1].num = nt(int64_t(x));
+				for(uint i = 0; i < m; i++){
+					d += unzigzag(r[i] + ref);
+					x += d;
+					out[i + 2].num = nt(int64_t(x));
+				}
+			}
+		}
+
+		template<typename T>
+		struct codec_check {
+			static_assert(
+				std::is_integral<typename T::num_type>::value
+					&& sizeof(typename T::num_type) <= 8,
+				"Only static floats up to 64 bits could be coded!"
+			);
+		};
+
+	} // namespace detail
+
+	////////////////////////////////////
+
+	/**
+	 * @class sf_encoder
+	 * @brief Streaming encoder of series of T.
+	 * Only one block is buffered, full blocks are appended to output
+	 * as soon as they are complete.
+	 * @param T static float type, up to 64 bits
+	 */
+	template<typename T>
+	class sf_encoder : detail::codec_check<T> {
+	private:
+		T buf[detail::codec_block];
+		uint fill;
+
+		static void put_block(const T* x, uint n, std::vector<uint8_t>& out) {
+			const size_t s = out.size();
+			out.resize(s + detail::codec_max_block_bytes);
+			out.resize(s + detail::codec_encode_block(x, n, &out[s]));
+		}
+
+		////////////////////////////
+
+	public:
+		sf_encoder()
+			: fill(0) {
+		}
+
+		/**
+		 * Code n elements x, appending complete blocks to out.
+		 */
+		void write(const T* x, size_t n, std::vector<uint8_t>& out) {
+			size_t i = 0;
+			while(fill != 0 && i < n){
+				buf[fill++] = x[i++];
+				if(fill == detail::codec_block){
+					put_block(buf, fill, out);
+					fill = 0;
+				}
+			}
+			for(; i + detail::codec_block <= n; i += detail::codec_block){
+				put_block(x + i, detail::codec_block, out);
+			}
+			for(; i < n; i++){
+				buf[fill++] = x[i];
+			}
+		}
+
+		/**
+		 * Append buffered elements as short block, at end of series.
+		 */
+		void flush(std::vector<uint8_t>& out) {
+			if(fill){
+				put_block(buf, fill, out);
+				fill = 0;
+			}
+		}
+	};
+
+	/**
+	 * @class sf_decoder
+	 * @brief Streaming decoder of series of T from buffer of coded blocks.
+	 * Only one block is buffered.
+	 * @param T static float type, same as of encoder
+	 */
+	template<typename T>
+	class sf_decoder : detail::codec_check<T> {
+	private:
+		const uint8_t* p;
+		const uint8_t* end;
+		T buf[detail::codec_block];
+		uint pos;
+		uint len;
+
+		/**
+		 * Decode next block to out.
+		 * @return count of elements, 0 at end
+		 */
+		uint next_block(T* out) {
+			if(p == end){
+				return 0;
+			}
+			detail::codec_header h;
+			if(!h.parse(p, end)){
+				throw exceptions::format_error()
+					<< "Coded series is not valid" << exceptions::endl;
+			}
+			detail::codec_decode_block(h, end, out);
+			p = h.next;
+			return h.n;
+		}
+
+		////////////////////////////
+
+	public:
+		sf_decoder(const uint8_t* data, size_t bytes)
+			: p(data), end(data + bytes), pos(0), len(0) {
+		}
+
+		/**
+		 * Decode up to n elements to out.
+		 * @return count of elements, less than n only at end of series
+		 */
+		size_t read(T* out, size_t n) {
+			size_t i = 0;
+			while(i < n){
+				if(pos < len){
+					const size_t c = len - pos < n - i ? len - pos : n - i;
+					for(size_t j = 0; j < c; j++){
+						out[i + j] = buf[pos + j];
+					}
+					pos += uint(c);
+					i += c;
+				}else if(n - i >= detail::codec_block){
+					// Whole block fits, so it goes directly to out.
+					const uint c = next_block(out + i);
+					if(!c){
+						break;
+					}
+					i += c;
+				}else{
+					len = next_block(buf);
+					pos = 0;
+					if(!len){
+						break;
+					}
+				}
+			}
+			return i;
+		}
+	};
+
+	////////////////////////////////////
+
+	/**
+	 * @class sf_compressed
+	 * @brief Coded series of T in memory, with index of blocks
+	 * for random access at block granularity.
+	 * @param T static float type, up to 64 bits
+	 */
+	template<typename T>
+	class sf_compressed : detail::codec_check<T> {
+	private:
+		std::vector<uint8_t> bytes;
+		/// Offset of every block, and of end.
+		std::vector<size_t> offset;
+		size_t count;
+
+		////////////////////////////
+
+	public:
+		static constexpr uint block_size = detail::codec_block;
+
+		sf_compressed()
+			: offset(1, 0), count(0) {
+		}
+
+		sf_compressed(const T* x, size_t n)
+			: count(n) {
+			sf_encoder<T> enc;
+			offset.reserve(n/block_size + 2);
+			for(size_t i = 0; i < n; i += block_size){
+				offset.push_back(bytes.size());
+				enc.write(x + i, n - i < block_size ? n - i : block_size, bytes);
+			}
+			enc.flush(bytes);
+			offset.push_back(bytes.size());
+			bytes.shrink_to_fit();
+		}
+
+		/**
+		 * Index coded series of sf_encoder, without decoding it.
+		 * Only last block could be short.
+		 */
+		explicit sf_compressed(std::vector<uint8_t> coded)
+			: bytes(std::move(coded)), count(0) {
+			const uint8_t* p = bytes.data();
+			const uint8_t* end = p + bytes.size();
+			while(p != end){
+				detail::codec_header h;
+				if(!h.parse(p, end) || count % block_size != 0){
+					throw exceptions::format_error()
+						<< "Coded series is not valid" << exceptions::endl;
+				}
+				offset.push_back(size_t(p - bytes.data()));
+				count += h.n;
+				p = h.next;
+			}
+			offset.push_back(bytes.size());
+		}
+
+		////////////////////////////
+
+	public:
+		size_t size() const {
+			return count;
+		}
+
+		size_t blocks() const {
+			return offset.size() - 1;
+		}
+
+		/// Coded blocks, which are input of sf_decoder.
+		const std::vector<uint8_t>& data() const {
+			return bytes;
+		}
+
+		/**
+		 * Decode block k, elements from k*block_size, to out.
+		 * @return count of elements
+		 */
+		uint decode_block(size_t k, T* out) const {
+			detail::codec_header h;
+			const uint8_t* end = bytes.data() + bytes.size();
+			h.parse(bytes.data() + offset[k], end);
+			detail::codec_decode_block(h, end, out);
+			return h.n;
+		}
+
+		/**
+		 * Decode all elements to out.
+		 */
+		void decode(T* out) const {
+			for(size_t k = 0; k < blocks(); k++){
+				decode_block(k, out + k*block_size);
+			}
+		}
+
+		/**
+		 * Element i, decoding only its block.
+		 */
+		T at(size_t i) const {
+			T b[block_size];
+			decode_block(i/block_size, b);
+			return b[i % block_size];
+		}
+	};
+
+	////////////////////////////////////
+
+} // namespace static_float
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // STATIC_FLOAT_CODEC_H_
@@ -0,0 +1,415 @@
+/**
+ * @file static_float_complex.h
+ * @date Oct 19, 2026
+ *
+ * @author Milos Subotic <milos.subotic.sm@gmail.com>
+ * @license MIT
+ *
+ * @brief Complex static float-point numbers.
+ *
+ * @version 1.0
+ * Changelog:
+ * 1.0 - Initial version.
+ *
+ */
+
+#ifndef STATIC_FLOAT_COMPLEX_H_
+#define STATIC_FLOAT_COMPLEX_H_
+
+///////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+#include <complex>
+#include <type_traits>
+#include <cassert>
+
+#include "static_float.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+namespace static_float {
+
+	/**
+	 * @class csf
+	 * @brief Complex number with signed static float parts.
+	 * @param B bits of parts without sign bit
+	 * @param E exponent
+	 */
+	template<uint B, int E = 0>
+	class csf {
+	public:
+		typedef sf<B, E> value_type;
+
+		static constexpr uint b = B;
+		static constexpr int e = E;
+
+		value_type re;
+		value_type im;
+
+		////////////////////////////////
+
+	public:
+		csf() {
+		}
+
+		csf(const value_type& re, const value_type& im)
+			: re(re), im(im) {
+		}
+
+		csf(double re, double im = 0)
+			: re(re), im(im) {
+		}
+
+		template<uint B2, int E2>
+		explicit csf(const csf<B2, E2>& c2)
+			: re(c2.re), im(c2.im) {
+		}
+
+		////////////////////////////////
+
+	public:
+		template<uint B2, int E2>
+		csf& operator=(const csf<B2, E2>& c2) {
+			re = c2.re;
+			im = c2.im;
+			return *this;
+		}
+
+		template<uint B2, int E2>
+		csf& operator+=(const csf<B2, E2>& c2) {
+			re += c2.re;
+			im += c2.im;
+			return *this;
+		}
+
+		////////////////////////////////
+
+	public:
+		explicit operator std::complex<double>() const {
+			return std::complex<double>(double(float(re)), double(float(im)));
+		}
+
+		////////////////////////////////
+
+	};
+
+	template<uint B1, int E1, uint B2, int E2>
+	bool operator==(const csf<B1, E1>& c1, const csf<B2, E2>& c2) {
+		return c1.re == c2.re && c1.im == c2.im;
+	}
+
+	namespace detail {
+
+		/**
+		 * Relative cost of multiplication in integer T of B bits,
+		 * where cost of addition is 1.
+		 * 128 bit multiplication is 3 native ones, but addition is 2 too.
+		 * GMP multiplication grows with limbs, but for few limbs it is
+		 * dominated by allocation of result, as addition is.
+		 */
+		template<typename T, uint B>
+		struct mul_cost {
+			static constexpr uint value = sizeof(T) <= sizeof(int64_t)
+				? 1
+				: std::is_same<T, int128_t>::value
+					? 2
+					: 1 + B/512;
+		};
+
+		/**
+		 * Cost of conversion of part to integer T.
+		 * It is free for native integers, but GMP allocates copy.
+		 */
+		template<typename T>
+		struct copy_cost {
+			static constexpr uint value =
+				std::is_integral<T>::value || std::is_same<T, int128_t>::value
+					? 0
+					: 1;
+		};
+
+	} // namespace detail
+
+	////////////////////////////////////
+
+} // namespace static_float
+
+
+namespace rt {
+
+	template<uint B1, int E1, uint B2, int E2>
+	struct add_sub<static_float::csf<B1, E1>, static_float::csf<B2, E2>> {
+		typedef typename add_sub<
+			static_float::sf<B1, E1>,
+			static_float::sf<B2, E2>
+		>::rt _p;
+		typedef static_float::csf<_p::b, _p::e> rt;
+	};
+
+	template<uint B1, int E1, uint B2, int E2>
+	struct mul<static_float::csf<B1, E1>, static_float::csf<B2, E2>> {
+		typedef static_float::csf<B1 + B2 + 1, E1 + E2> rt;
+		typedef typename rt::value_type::num_type ct;
+		// Sums of parts in 3-mult form need one bit more.
+		typedef typename static_float::sf<B1 + B2 + 2>::num_type ct3;
+		/// 4-mult form is 4 mul, 2 add and 8 conversions of parts,
+		/// 3-mult form is 3 mul, 5 add and 4 conversions.
+		constexpr static bool mul3 =
+			3*static_float::detail::mul_cost<ct3, B1 + B2 + 2>::value + 5
+				+ 4*static_float::detail::copy_cost<ct3>::value
+			< 4*static_float::detail::mul_cost<ct, B1 + B2 + 1>::value + 2
+				+ 8*static_float::detail::copy_cost<ct>::value;
+	};
+
+	template<uint B1, int E1, uint B2, int E2>
+	struct mul<static_float::csf<B1, E1>, static_float::sf<B2, E2>> {
+		typedef static_float::csf<B1 + B2, E1 + E2> rt;
+		typedef typename rt::value_type::num_type ct;
+	};
+
+	template<uint B, int E>
+	struct norm<static_float::csf<B, E>> {
+		typedef static_float::usf<B*2 + 1, E*2> rt;
+		typedef typename rt::num_type ct;
+	};
+
+} // namespace rt
+
+
+namespace static_float {
+
+	template<uint B1, int E1, uint B2, int E2>
+	typename rt::add_sub<csf<B1, E1>, csf<B2, E2>>::rt
+	operator+(const csf<B1, E1>& c1, const csf<B2, E2>& c2) {
+		return typename rt::add_sub<csf<B1, E1>, csf<B2, E2>>::rt(
+			c1.re + c2.re,
+			c1.im + c2.im
+		);
+	}
+
+	template<uint B1, int E1, uint B2, int E2>
+	typename rt::add_sub<csf<B1, E1>, csf<B2, E2>>::rt
+	operator-(const csf<B1, E1>& c1, const csf<B2, E2>& c2) {
+		return typename rt::add_sub<csf<B1, E1>, csf<B2, E2>>::rt(
+			c1.re - c2.re,
+			c1.im - c2.im
+		);
+	}
+
+	/**
+	 * Complex product with 4 multiplications and 2 additions.
+	 */
+	template<uint B1, int E1, uint B2, int E2>
+	typename rt::mul<csf<B1, E1>, csf<B2, E2>>::rt
+	mul4(const csf<B1, E1>& c1, const csf<B2, E2>& c2) {
+		typedef typename rt::mul<csf<B1, E1>, csf<B2, E2>> m;
+		typedef typename m::ct ct;
+		typename m::rt r;
+		r.re.num = ct(c1.re.num) * ct(c2.re.num)
+			- ct(c1.im.num) * ct(c2.im.num);
+		r.im.num = ct(c1.re.num) * ct(c2.im.num)
+			+ ct(c1.im.num) * ct(c2.re.num);
+		return r;
+	}
+
+	/**
+	 * Complex product with 3 multiplications and 5 additions (Gauss).
+	 * k1 = c*(a + b), k2 = a*(d - c), k3 = b*(c + d),
+	 * (a + bi)*(c + di) = (k1 - k3) + (k1 + k2)i.
+	 * Result is exactly the same as from mul4().
+	 */
+	template<uint B1, int E1, uint B2, int E2>
+	typename rt::mul<csf<B1, E1>, csf<B2, E2>>::rt
+	mul3(const csf<B1, E1>& c1, const csf<B2, E2>& c2) {
+		typedef typename rt::mul<csf<B1, E1>, csf<B2, E2>> m;
+		typedef typename m::ct ct;
+		typedef typename m::ct3 ct3;
+		const ct3 a = c1.re.num;
+		const ct3 b = c1.im.num;
+		const ct3 c = c2.re.num;
+		const ct3 d = c2.im.num;
+		const ct3 k1 = c*(a + b);
+		const ct3 k2 = a*(d - c);
+		const ct3 k3 = b*(c + d);
+		typename m::rt r;
+		r.re.num = ct(k1 - k3);
+		r.im.num = ct(k1 + k2);
+		return r;
+	}
+
+	/**
+	 * Complex product, in form which is cheaper for type of parts.
+	 */
+	template<uint B1, int E1, uint B2, int E2>
+	typename rt::mul<csf<B1, E1>, csf<B2, E2>>::rt
+	operator*(const csf<B1, E1>& c1, const csf<B2, E2>& c2) {
+		return rt::mul<csf<B1, E1>, csf<B2, E2>>::mul3
+			? mul3(c1, c2)
+			: mul4(c1, c2);
+	}
+
+	template<uint B1, int E1, uint B2, int E2>
+	typename rt::mul<csf<B1, E1>, sf<B2, E2>>::rt
+	operator*(const csf<B1, E1>& c, const sf<B2, E2>& s) {
+		return typename rt::mul<csf<B1, E1>, sf<B2, E2>>::rt(
+			c.re * s,
+			c.im * s
+		);
+	}
+
+	template<uint B1, int E1, uint B2, int E2>
+	typename rt::mul<csf<B1, E1>, sf<B2, E2>>::rt
+	operator*(const sf<B2, E2>& s, const csf<B1, E1>& c) {
+		return c * s;
+	}
+
+	template<uint B, int E>
+	csf<B, E> conj(const csf<B, E>& c) {
+		csf<B, E> r;
+		r.re = c.re;
+		r.im.num = -c.im.num;
+		return r;
+	}
+
+	/**
+	 * Squared magnitude, re^2 + im^2.
+	 */
+	template<uint B, int E>
+	typename rt::norm<csf<B, E>>::rt
+	norm(const csf<B, E>& c) {
+		return sq(c.re) + sq(c.im);
+	}
+
+	/**
+	 * Complex multiply and accumulate, acc += x*y.
+	 * Accumulator have exponent of product.
+	 */
+	template<uint BA, int EA, uint B1, int E1, uint B2, int E2>
+	csf<BA, EA>&
+	mac(csf<BA, EA>& acc, const csf<B1, E1>& x, const csf<B2, E2>& y) {
+		static_assert(EA == E1 + E2, "Exponent of accumulator is wrong!");
+		static_assert(
+			BA >= B1 + B2 + 1,
+			"Accumulator is narrower than product!"
+		);
+		typedef typename sf<BA, EA>::num_type ct;
+		auto p = x*y;
+		acc.re.num += ct(p.re.num);
+		acc.im.num += ct(p.im.num);
+		return acc;
+	}
+
+	////////////////////////////////////
+
+	/**
+	 * @class csf_array
+	 * @brief Array of complex numbers with parts in separate arrays (SoA),
+	 * for batch kernels which are vectorized.
+	 */
+	template<typename C>
+	class csf_array {
+	public:
+		typedef C complex_type;
+		typedef typename C::value_type value_type;
+
+		std::vector<value_type> re;
+		std::vector<value_type> im;
+
+		////////////////////////////////
+
+	public:
+		csf_array() {
+		}
+
+		explicit csf_array(size_t n)
+			: re(n), im(n) {
+		}
+
+		size_t size() const {
+			return re.size();
+		}
+
+		void resize(size_t n) {
+			re.resize(n);
+			im.resize(n);
+		}
+
+		C get(size_t i) const {
+			return C(re[i], im[i]);
+		}
+
+		void set(size_t i, const C& c) {
+			re[i] = c.re;
+			im[i] = c.im;
+		}
+
+		////////////////////////////////
+
+	};
+
+	namespace detail {
+		template<typename CA, typename C1, typename C2>
+		void csf_mac_kernel(
+			CA* __restrict acc_re,
+			CA* __restrict acc_im,
+			const C1* __restrict x_re,
+			const C1* __restrict x_im,
+			const C2* __restrict y_re,
+			const C2* __restrict y_im,
+			size_t n
+		) {
+			for(size_t i = 0; i < n; i++){
+				csf<C1::b, C1::e> x(x_re[i], x_im[i]);
+				csf<C2::b, C2::e> y(y_re[i], y_im[i]);
+				auto p = x*y;
+				acc_re[i].num += p.re.num;
+				acc_im[i].num += p.im.num;
+			}
+		}
+	} // namespace detail
+
+	/**
+	 * Element wise acc[i] += x[i]*y[i].
+	 */
+	template<uint BA, int EA, uint B1, int E1, uint B2, int E2>
+	void mac(
+		csf_array<csf<BA, EA>>& acc,
+		const csf_array<csf<B1, E1>>& x,
+		const csf_array<csf<B2, E2>>& y
+	) {
+		static_assert(EA == E1 + E2, "Exponent of accumulator is wrong!");
+		static_assert(
+			BA >= B1 + B2 + 1,
+			"Accumulator is narrower than product!"
+		);
+		assert(acc.size() == x.size() && acc.size() == y.size());
+		detail::csf_mac_kernel(
+			acc.re.data(), acc.im.data(),
+			x.re.data(), x.im.data(),
+			y.re.data(), y.im.data(),
+			acc.size()
+		);
+	}
+
+	/**
+	 * Element wise out[i] = x[i]*y[i].
+	 */
+	template<uint B1, int E1, uint B2, int E2>
+	void mul(
+		const csf_array<csf<B1, E1>>& x,
+		const csf_array<csf<B2, E2>>& y,
+		csf_array<typename rt::mul<csf<B1, E1>, csf<B2, E2>>::rt>& out
+	) {
+		assert(out.size() == x.size() && out.size() == y.size());
+		for(size_t i = 0; i < out.size(); i++){
+			out.set(i, x.get(i)*y.get(i));
+		}
+	}
+
+	////////////////////////////////////
+
+} // namespace static_float
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // STATIC_FLOAT_COMPLEX_H_
@@ -0,0 +1,337 @@
+/**
+ * @file static_float_constant.h
+ * @date Oct 19, 2026
+ *
+ * @author Milos Subotic <milos.subotic.sm@gmail.com>
+ * @license MIT
+ *
+ * @brief Multiplication and division by compile time constants.
+ *
+ * @version 1.0
+ * Changelog:
+ * 1.0 - Initial version.
+ *
+ */
+
+#ifndef STATIC_FLOAT_CONSTANT_H_
+#define STATIC_FLOAT_CONSTANT_H_
+
+///////////////////////////////////////////////////////////////////////////////
+
+#include "static_float.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Maximal number of non-zero canonical signed digits of constant multiplier
+ * for which multiplication is done with shift/add chain instead of multiply.
+ */
+#ifndef STATIC_FLOAT_CSD_MAX_TERMS
+#define STATIC_FLOAT_CSD_MAX_TERMS 3
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+
+namespace static_float {
+
+	namespace detail {
+
+		/**
+		 * @return number of trailing zeros, 0 for x == 0.
+		 */
+		constexpr uint ctz(int64_t x) {
+			return x == 0 || (x & 1) ? 0 : 1 + ctz(x / 2);
+		}
+
+		constexpr uint64_t abs(int64_t x) {
+			return x < 0 ? uint64_t(-x) : uint64_t(x);
+		}
+
+		/**
+		 * Canonical signed digit of odd x: +1 or -1.
+		 * Choosing digit on this way leave even x - digit divisible by 4,
+		 * so no two adjacent digits are non-zero.
+		 */
+		constexpr int64_t csd_digit(int64_t x) {
+			return (x & 3) == 1 ? 1 : -1;
+		}
+
+		/**
+		 * @return number of non-zero digits in canonical signed digit
+		 * representation of x.
+		 */
+		constexpr uint csd_weight(int64_t x) {
+			return x == 0
+				? 0
+				: (x & 1)
+					? 1 + csd_weight((x - csd_digit(x)) / 2)
+					: csd_weight(x / 2);
+		}
+
+		/**
+		 * Shift/add chain for multiplication by odd constant N.
+		 * x*N = ((x*next) << sh) + digit*x
+		 */
+		template<int64_t N, bool zero = N == 0>
+		struct csd_chain {
+			static constexpr int64_t digit = csd_digit(N);
+			static constexpr int64_t rest = (N - digit) / 2;
+			static constexpr uint sh = rest ? ctz(rest) + 1 : 0;
+			static constexpr int64_t next = rest ? rest >> (sh - 1) : 0;
+
+			template<typename T>
+			static T apply(const T& x) {
+				T hi = T(csd_chain<next>::apply(x) << sh);
+				return digit > 0 ? T(hi + x) : T(hi - x);
+			}
+		};
+
+		template<int64_t N>
+		struct csd_chain<N, true> {
+			template<typename T>
+			static T apply(const T&) {
+				return T(0);
+			}
+		};
+
+		/**
+		 * Multiplication by constant N.
+		 * Sparse constants are done with shift/add chains,
+		 * all others with ordinary multiply.
+		 */
+		template<
+			int64_t N,
+			bool sparse = csd_weight(N) <= STATIC_FLOAT_CSD_MAX_TERMS
+		>
+		struct const_mul {
+			template<typename T>
+			static T apply(const T& x) {
+				return x * T(N);
+			}
+		};
+
+		template<int64_t N>
+		struct const_mul<N, true> {
+			template<typename T>
+			static T apply(const T& x) {
+				return csd_chain<N>::apply(x);
+			}
+		};
+
+		/**
+		 * Granlund-Montgomery division of unsigned u < 2^N by odd D > 1.
+		 * With l = ceil(log2(D)) and m = ceil(2^(N+l)/D) which is N+1 bits
+		 * wide, u/D == (u*m) >> (N+l) for every u < 2^N.
+		 * Product is 2N+1 bits wide, so it is done in 64 bits for N < 32
+		 * and in 128 bits for N < 64. Wider dividends are divided ordinary.
+		 */
+		template<
+			uint64_t D,
+			uint N,
+			uint W = 2*N + 1 <= 64 && N + ceil_log2(D) < 64
+				? 64
+				: 2*N + 1 <= 128 && N + ceil_log2(D) < 128
+					? 128
+					: 0
+		>
+		struct magic_div {
+			template<typename T>
+			static T apply(const T& u) {
+				return T(u / T(D));
+			}
+		};
+
+		template<uint64_t D, uint N>
+		struct magic_div<D, N, 64> {
+			static constexpr uint sh = N + ceil_log2(D);
+			static constexpr uint64_t m = ((uint64_t(1) << sh) + D - 1) / D;
+
+			template<typename T>
+			static T apply(const T& u) {
+				return T((uint64_t(u) * m) >> sh);
+			}
+		};
+
+		template<uint64_t D, uint N>
+		struct magic_div<D, N, 128> {
+			static constexpr uint sh = N + ceil_log2(D);
+
+			static constexpr uint128_t m() {
+				return ((uint128_t(1) << sh) + D - 1) / D;
+			}
+
+			template<typename T>
+			static T apply(const T& u) {
+				return T((uint128_t(u) * m()) >> sh);
+			}
+		};
+
+	} // namespace detail
+
+	////////////////////////////////////
+
+	/**
+	 * @class sf_const
+	 * @brief Compile time static float constant of value N*2^E.
+	 * Constant is kept normalized, with trailing zero bits of N moved to
+	 * exponent, so types of results depend on actual value of constant
+	 * and not on width in which it is declared,
+	 * ie. sf_const<64, -7> is the same as sf_const<1, -1>.
+	 * @param N integer value
+	 * @param E exponent
+	 */
+	template<int64_t N, int E = 0>
+	struct sf_const {
+		static_assert(N != 0, "Constant must not be zero!");
+
+		/// Odd integer value.
+		static constexpr int64_t num = N >> detail::ctz(N);
+		static constexpr int e = E + int(detail::ctz(N));
+		/// Bits without sign bit.
+		static constexpr uint b = detail::bit_width(detail::abs(num));
+
+		static constexpr bool is_pow2 = num == 1 || num == -1;
+
+		typedef sf<b, e> type;
+
+		static type value() {
+			return type(typename type::num_type(num), type::num_field);
+		}
+	};
+
+	////////////////////////////////////
+
+} // namespace static_float
+
+
+namespace rt {
+
+	template<uint B, int E, int64_t N, int EC>
+	struct mul_by<static_float::sf<B, E>, static_float::sf_const<N, EC>> {
+		typedef static_float::sf_const<N, EC> c;
+		// Multiplication with -2^B need one bit more for negative constant.
+		constexpr static uint _c_b = c::num > 0
+			? static_float::detail::ceil_log2(c::num)
+			: c::b;
+		typedef static_float::sf<B + _c_b, E + c::e> rt;
+		typedef typename rt::num_type ct;
+	};
+
+	template<uint B, int E, int64_t N, int EC>
+	struct mul_by<static_float::usf<B, E>, static_float::sf_const<N, EC>> {
+		typedef static_float::sf_const<N, EC> c;
+		static_assert(c::num > 0, "Unsigned static float by negative const!");
+		typedef static_float::usf<
+			B + static_float::detail::ceil_log2(c::num),
+			E + c::e
+		> rt;
+		typedef typename rt::num_type ct;
+	};
+
+	template<uint B, int E, int64_t N, int EC>
+	struct div_by<static_float::sf<B, E>, static_float::sf_const<N, EC>> {
+		typedef static_float::sf_const<N, EC> c;
+		// Dividend is shifted for bits of divisor, same as in operator/,
+		// so quotient is less than 2^(B+1).
+		constexpr static uint SH = c::is_pow2 ? 0 : c::b;
+		typedef static_float::sf<
+			B + (c::num == 1 ? 0 : 1),
+			E - c::e - int(SH)
+		> rt;
+		typedef typename rt::num_type ct;
+		// Absolute value of shifted dividend.
+		constexpr static uint _u_b = B + 1 + SH;
+		typedef typename static_float::usf<_u_b, 0>::num_type ut;
+	};
+
+	template<uint B, int E, int64_t N, int EC>
+	struct div_by<static_float::usf<B, E>, static_float::sf_const<N, EC>> {
+		typedef static_float::sf_const<N, EC> c;
+		static_assert(c::num > 0, "Unsigned static float by negative const!");
+		constexpr static uint SH = c::is_pow2 ? 0 : c::b;
+		typedef static_float::usf<
+			B + (c::is_pow2 ? 0 : 1),
+			E - c::e - int(SH)
+		> rt;
+		typedef typename rt::num_type ct;
+		constexpr static uint _u_b = B + SH;
+		typedef typename static_float::usf<_u_b, 0>::num_type ut;
+	};
+
+} // namespace rt
+
+
+namespace static_float {
+
+	/**
+	 * Multiply by compile time constant.
+	 * Usage: mul_by<sf_const<5, -3>>(x) is x*0.625.
+	 */
+	template<typename C, uint B, int E>
+	typename rt::mul_by<sf<B, E>, C>::rt
+	mul_by(const sf<B, E>& x) {
+		typedef typename rt::mul_by<sf<B, E>, C> m;
+		typedef typename m::ct ct;
+		typename m::rt r;
+		r.num = detail::const_mul<C::num>::apply(ct(x.num));
+		return r;
+	}
+
+	template<typename C, uint B, int E>
+	typename rt::mul_by<usf<B, E>, C>::rt
+	mul_by(const usf<B, E>& x) {
+		typedef typename rt::mul_by<usf<B, E>, C> m;
+		typedef typename m::ct ct;
+		typename m::rt r;
+		r.num = detail::const_mul<C::num>::apply(ct(x.num));
+		return r;
+	}
+
+	/**
+	 * Divide by compile time constant.
+	 * Quotient have same precision as with operator/ and it is truncated
+	 * toward zero. Division is done with multiply-high and shift.
+	 * Usage: div_by<sf_const<3>>(x) is x/3.
+	 */
+	template<typename C, uint B, int E>
+	typename rt::div_by<sf<B, E>, C>::rt
+	div_by(const sf<B, E>& x) {
+		typedef typename rt::div_by<sf<B, E>, C> d;
+		typedef typename d::ct ct;
+		typedef typename d::ut ut;
+		typename d::rt r;
+		if(C::is_pow2){
+			r.num = C::num > 0 ? ct(x.num) : ct(-ct(x.num));
+		}else{
+			bool neg = x.num < 0;
+			ut u = ut(neg ? -ct(x.num) : ct(x.num)) << d::SH;
+			ut q = detail::magic_div<detail::abs(C::num), d::_u_b>::apply(u);
+			r.num = neg != (C::num < 0) ? ct(-ct(q)) : ct(q);
+		}
+		return r;
+	}
+
+	template<typename C, uint B, int E>
+	typename rt::div_by<usf<B, E>, C>::rt
+	div_by(const usf<B, E>& x) {
+		typedef typename rt::div_by<usf<B, E>, C> d;
+		typedef typename d::ct ct;
+		typedef typename d::ut ut;
+		typename d::rt r;
+		if(C::is_pow2){
+			r.num = x.num;
+		}else{
+			ut u = ut(x.num) << d::SH;
+			ut q = detail::magic_div<detail::abs(C::num), d::_u_b>::apply(u);
+			r.num = ct(q);
+		}
+		return r;
+	}
+
+	////////////////////////////////////
+
+} // namespace static_float
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // STATIC_FLOAT_CONSTANT_H_
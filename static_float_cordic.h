@@ -0,0 +1,401 @@
+/**
+ * @file static_float_cordic.h
+ * @date Oct 19, 2026
+ *
+ * @author Milos Subotic <milos.subotic.sm@gmail.com>
+ * @license MIT
+ *
+ * @brief CORDIC trigonometric functions on static floats.
+ *
+ * @version 1.0
+ * Changelog:
+ * 1.0 - Initial version.
+ *
+ */
+
+#ifndef STATIC_FLOAT_CORDIC_H_
+#define STATIC_FLOAT_CORDIC_H_
+
+///////////////////////////////////////////////////////////////////////////////
+
+#include <type_traits>
+
+#include "static_float.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+namespace static_float {
+
+	namespace detail {
+
+		// Compile time math in long double, C++11 constexpr.
+
+		constexpr long double cordic_pi = 3.14159265358979323846264338327950288L;
+
+		/**
+		 * Series of atan(x) = x - x^3/3 + x^5/5 - ..., from term k on,
+		 * for |x| <= 1/2. p is x^(2k+1).
+		 */
+		constexpr long double atan_series(long double x2, long double p, uint k) {
+			return p < 1e-40L
+				? 0.0L
+				: (k % 2 ? -p : p)/(2*k + 1) + atan_series(x2, p*x2, k + 1);
+		}
+
+		/**
+		 * @return atan(2^-i)
+		 */
+		constexpr long double cordic_angle(uint i) {
+			return i == 0
+				? cordic_pi/4
+				: atan_series(pow2_neg(2*i), pow2_neg(i), 0);
+		}
+
+		/**
+		 * Squared gain of n iterations, product of 1 + 2^-2i.
+		 */
+		constexpr long double cordic_gain2(uint n) {
+			return n == 0 ? 1.0L : cordic_gain2(n - 1)*(1 + pow2_neg(2*(n - 1)));
+		}
+
+		constexpr long double sqrt_newton(long double x, long double g, uint n) {
+			return n == 0 ? g : sqrt_newton(x, (g + x/g)/2, n - 1);
+		}
+
+		/**
+		 * Constants of CORDIC with N iterations and W fraction bits.
+		 */
+		template<uint N, uint W>
+		struct cordic_const {
+			template<uint I>
+			struct angle {
+				static constexpr int64_t value =
+					round_ld(cordic_angle(I)*pow2(W));
+			};
+
+			/// 1/gain, so that rotation of (1/gain, 0) is on unit circle.
+			static constexpr int64_t inv_gain = round_ld(
+				pow2(W)/sqrt_newton(cordic_gain2(N), 1.5L, 8)
+			);
+			static constexpr int64_t half_pi = round_ld(cordic_pi/2*pow2(W));
+			static constexpr int64_t pi = round_ld(cordic_pi*pow2(W));
+			/// 2/pi with 16 fraction bits for quadrant estimation.
+			static constexpr int64_t two_over_pi_16 = round_ld(2/cordic_pi*65536);
+
+			template<typename S>
+			struct table_impl;
+
+			template<uint... I>
+			struct table_impl<index_seq<I...>> {
+				static const int64_t angle[N];
+			};
+
+			typedef table_impl<typename make_index_seq<N>::type> table;
+		};
+
+		template<uint N, uint W>
+		template<uint... I>
+		const int64_t cordic_const<N, W>::table_impl<index_seq<I...>>::angle[N]
+			= { cordic_const<N, W>::angle<I>::value... };
+
+		/**
+		 * CORDIC of sf<B, E>: B iterations, B + G fraction bits.
+		 * Iterations are in 32 bit type when it is enough,
+		 * because 64 bit arithmetic shift is not vectorized on x86.
+		 */
+		template<uint B>
+		struct cordic_traits {
+			static_assert(B >= 2 && B <= 30, "CORDIC is for 2 to 30 bits!");
+			static constexpr uint N = B;
+			static constexpr uint G = 3;
+			static constexpr uint W = B + G;
+			typedef cordic_const<N, W> c;
+			/// Gain and pi/2 range need 2 integer bits.
+			typedef typename std::conditional<
+				W + 2 < 32,
+				int32_t,
+				int64_t
+			>::type wt;
+		};
+
+		/**
+		 * Reduce angle to |z| <= pi/4 + error of quadrant estimate,
+		 * z in W fraction bits. q is quadrant, multiple of pi/2.
+		 */
+		template<uint W, typename T, uint B, int E>
+		inline void cordic_reduce(const sf<B, E>& theta, T& z, T& q) {
+			constexpr int sh = int(W) + E;
+			static_assert(int(B) + sh < 62, "Angle is too wide for CORDIC!");
+			typedef typename std::conditional<
+				int(B) + sh < 31 && W + 2 < 32,
+				int32_t,
+				int64_t
+			>::type at;
+			typedef cordic_const<1, W> c;
+			const at t = sh >= 0
+				? at(at(theta.num) << (sh >= 0 ? sh : 0))
+				: round_shift<round_nearest, (sh < 0 ? -sh : 0)>(
+					at(theta.num)
+				);
+			// Only few bits of t are needed to estimate quadrant.
+			constexpr uint TSH = W > 16 ? W - 16 : 0;
+			constexpr uint F = W - TSH + 16;
+			const at k = at((int64_t(t >> TSH)*c::two_over_pi_16
+				+ (int64_t(1) << (F - 1))) >> F);
+			z = T(t - k*at(c::half_pi));
+			q = T(k & 3);
+		}
+
+		/**
+		 * Rotation mode, iterations from I on, unrolled.
+		 * Direction is chosen from sign mask of z, without branches.
+		 */
+		template<uint N, uint W, typename T, uint I = 0, bool end = I == N>
+		struct cordic_rotate_unrolled {
+			static void apply(T& x, T& y, T& z) {
+				// d is 0 for z >= 0 and -1 for z < 0.
+				const T d = z >> (8*sizeof(T) - 1);
+				const T dx = ((y >> I) ^ d) - d;
+				const T dy = ((x >> I) ^ d) - d;
+				const T a = T(cordic_const<N, W>::template angle<I>::value);
+				x -= dx;
+				y += dy;
+				z -= (a ^ d) - d;
+				cordic_rotate_unrolled<N, W, T, I + 1>::apply(x, y, z);
+			}
+		};
+
+		template<uint N, uint W, typename T, uint I>
+		struct cordic_rotate_unrolled<N, W, T, I, true> {
+			static void apply(T&, T&, T&) {
+			}
+		};
+
+		/**
+		 * Rotation mode, (x, y) is rotated for z.
+		 */
+		template<uint N, uint W, typename T>
+		inline void cordic_rotate(T& x, T& y, T& z) {
+			const int64_t* angle = cordic_const<N, W>::table::angle;
+			for(uint i = 0; i < N; i++){
+				const T xs = x >> i;
+				const T ys = y >> i;
+				if(z >= 0){
+					x -= ys;
+					y += xs;
+					z -= T(angle[i]);
+				}else{
+					x += ys;
+					y -= xs;
+					z += T(angle[i]);
+				}
+			}
+		}
+
+		/**
+		 * Vectoring mode, (x, y) is rotated to x axis, angle is added to z.
+		 * x must be non-negative.
+		 */
+		template<uint N, uint W, typename T>
+		inline void cordic_vector(T& x, T& y, T& z) {
+			const int64_t* angle = cordic_const<N, W>::table::angle;
+			for(uint i = 0; i < N; i++){
+				const T xs = x >> i;
+				const T ys = y >> i;
+				if(y < 0){
+					x -= ys;
+					y += xs;
+					z -= T(angle[i]);
+				}else{
+					x += ys;
+					y -= xs;
+					z += T(angle[i]);
+				}
+			}
+		}
+
+		/**
+		 * Left shift which normalizes vector (x, y) to B bits,
+		 * so short vectors don't lose precision in iterations.
+		 */
+		template<uint B>
+		inline uint cordic_norm_shift(int64_t x, int64_t y) {
+			const uint64_t m = uint64_t(x < 0 ? -x : x) | uint64_t(y < 0 ? -y : y);
+			const int w = m ? 64 - __builtin_clzll(m) : int(B);
+			return w < int(B) ? uint(int(B) - w) : 0;
+		}
+
+		/**
+		 * Rotate (c, s) for q*pi/2.
+		 */
+		template<typename T>
+		inline void cordic_quadrant(T q, T& c, T& s) {
+			const T c0 = c;
+			const T s0 = s;
+			c = q & 1 ? -s0 : c0;
+			s = q & 1 ? c0 : s0;
+			c = q & 2 ? -c : c;
+			s = q & 2 ? -s : s;
+		}
+
+		/**
+		 * Round x with W fraction bits to sf<B, 1-B>, saturated to [-1, 1].
+		 */
+		template<uint B, uint W, typename T>
+		inline sf<B, 1 - int(B)> cordic_unit(T x) {
+			constexpr uint SH = W - (B - 1);
+			constexpr T one = T(1) << (B - 1);
+			T v = round_shift<round_nearest, SH>(x);
+			v = v > one ? one : v < -one ? -one : v;
+			sf<B, 1 - int(B)> r;
+			r.num = typename sf<B, 1 - int(B)>::num_type(v);
+			return r;
+		}
+
+	} // namespace detail
+
+	////////////////////////////////////
+
+	/**
+	 * Sine and cosine of angle theta in radians with CORDIC.
+	 * Results have B bits of sf<B, E>, with range [-1, 1].
+	 */
+	template<uint B, int E>
+	void sincos(
+		const sf<B, E>& theta,
+		sf<B, 1 - int(B)>& s,
+		sf<B, 1 - int(B)>& c
+	) {
+		typedef detail::cordic_traits<B> t;
+		typedef typename t::wt wt;
+		wt z, q;
+		detail::cordic_reduce<t::W>(theta, z, q);
+		wt x = wt(t::c::inv_gain);
+		wt y = 0;
+		detail::cordic_rotate<t::N, t::W>(x, y, z);
+		detail::cordic_quadrant(q, x, y);
+		c = detail::cordic_unit<B, t::W>(x);
+		s = detail::cordic_unit<B, t::W>(y);
+	}
+
+	template<uint B, int E>
+	sf<B, 1 - int(B)> sin(const sf<B, E>& theta) {
+		sf<B, 1 - int(B)> s, c;
+		sincos(theta, s, c);
+		return s;
+	}
+
+	template<uint B, int E>
+	sf<B, 1 - int(B)> cos(const sf<B, E>& theta) {
+		sf<B, 1 - int(B)> s, c;
+		sincos(theta, s, c);
+		return c;
+	}
+
+	/**
+	 * Sine and cosine of n angles.
+	 * Iterations are unrolled and without branches, so loop is vectorized.
+	 */
+	template<uint B, int E>
+	void sincos(
+		const sf<B, E>* __restrict theta,
+		sf<B, 1 - int(B)>* __restrict s,
+		sf<B, 1 - int(B)>* __restrict c,
+		size_t n
+	) {
+		typedef detail::cordic_traits<B> t;
+		typedef typename t::wt wt;
+		for(size_t i = 0; i < n; i++){
+			wt z, q;
+			detail::cordic_reduce<t::W>(theta[i], z, q);
+			wt x = wt(t::c::inv_gain);
+			wt y = 0;
+			detail::cordic_rotate_unrolled<t::N, t::W, wt>::apply(x, y, z);
+			detail::cordic_quadrant(q, x, y);
+			c[i] = detail::cordic_unit<B, t::W>(x);
+			s[i] = detail::cordic_unit<B, t::W>(y);
+		}
+	}
+
+	/**
+	 * Angle of vector (x, y) in radians, in range [-pi, pi].
+	 */
+	template<uint B, int E>
+	sf<B, 2 - int(B)> atan2(const sf<B, E>& y, const sf<B, E>& x) {
+		typedef detail::cordic_traits<B> t;
+		typedef typename t::wt wt;
+		const uint sh = t::G + detail::cordic_norm_shift<B>(x.num, y.num);
+		wt vx = wt(wt(x.num) << sh);
+		wt vy = wt(wt(y.num) << sh);
+		wt z = 0;
+		// Rotate to right half plane for pi.
+		if(vx < 0){
+			vx = -vx;
+			vy = -vy;
+			z = wt(y.num < 0 ? -t::c::pi : t::c::pi);
+		}
+		detail::cordic_vector<t::N, t::W>(vx, vy, z);
+		sf<B, 2 - int(B)> r;
+		r.num = typename sf<B, 2 - int(B)>::num_type(
+			detail::round_shift<round_nearest, t::W - (B - 2)>(z)
+		);
+		return r;
+	}
+
+	/**
+	 * Length of vector (x, y), sqrt(x^2 + y^2).
+	 */
+	template<uint B, int E>
+	usf<B + 1, E> hypot(const sf<B, E>& x, const sf<B, E>& y) {
+		typedef detail::cordic_traits<B> t;
+		typedef typename t::wt wt;
+		const uint sh = t::G + detail::cordic_norm_shift<B>(x.num, y.num);
+		wt vx = wt(wt(x.num) << sh);
+		wt vy = wt(wt(y.num) << sh);
+		wt z = 0;
+		vx = vx < 0 ? -vx : vx;
+		detail::cordic_vector<t::N, t::W>(vx, vy, z);
+		const detail::int128_t l = detail::int128_t(vx)*t::c::inv_gain;
+		const uint rsh = t::W + sh;
+		usf<B + 1, E> r;
+		r.num = typename usf<B + 1, E>::num_type(
+			(l + (detail::int128_t(1) << (rsh - 1))) >> rsh
+		);
+		return r;
+	}
+
+	/**
+	 * Rotate vector (x, y) for angle theta in radians.
+	 * Length is kept, so result needs one bit more.
+	 */
+	template<uint B, int E, uint BA, int EA>
+	void rotate(
+		const sf<B, E>& x,
+		const sf<B, E>& y,
+		const sf<BA, EA>& theta,
+		sf<B + 1, E>& xo,
+		sf<B + 1, E>& yo
+	) {
+		typedef detail::cordic_traits<B> t;
+		typedef typename t::wt wt;
+		wt z, q;
+		detail::cordic_reduce<t::W>(theta, z, q);
+		const uint sh = t::G + detail::cordic_norm_shift<B>(x.num, y.num);
+		wt vx = wt(wt(x.num) << sh);
+		wt vy = wt(wt(y.num) << sh);
+		detail::cordic_rotate<t::N, t::W>(vx, vy, z);
+		detail::cordic_quadrant(q, vx, vy);
+		typedef typename sf<B + 1, E>::num_type nt;
+		const uint rsh = t::W + sh;
+		const detail::int128_t half = detail::int128_t(1) << (rsh - 1);
+		xo.num = nt((detail::int128_t(vx)*t::c::inv_gain + half) >> rsh);
+		yo.num = nt((detail::int128_t(vy)*t::c::inv_gain + half) >> rsh);
+	}
+
+	////////////////////////////////////
+
+} // namespace static_float
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // STATIC_FLOAT_CORDIC_H_
@@ -0,0 +1,864 @@
+/**
+ * @file static_float_decimal.h
+ * @date Oct 19, 2026
+ *
+ * @author Milos Subotic <milos.subotic.sm@gmail.com>
+ * @license MIT
+ *
+ * @brief Exact decimal formatting and parsing of static floats,
+ * with integer arithmetic only and without allocation.
+ *
+ * Value num*2^E have finite decimal expansion.
+ * to_chars() writes shortest decimal which from_chars() reads back
+ * to same num, and from_chars() rounds decimal to nearest num,
+ * halves toward +inf as round_nearest, so values round trip.
+ * Arithmetic is in unsigned __int128 when it is enough,
+ * and otherwise in fixed size array of limbs on stack.
+ *
+ * @version 1.0
+ * Changelog:
+ * 1.0 - Initial version.
+ *
+ */
+
+#ifndef STATIC_FLOAT_DECIMAL_H_
+#define STATIC_FLOAT_DECIMAL_H_
+
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstring>
+#include <ostream>
+#include <type_traits>
+
+#include "static_float.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+namespace static_float {
+
+	enum sf_parse_status {
+		sf_parse_ok,
+		/// No number at start of input.
+		sf_parse_invalid,
+		/// Number is out of range of T, so it is saturated.
+		sf_parse_out_of_range
+	};
+
+	struct sf_parse_result {
+		/// First char after number.
+		const char* ptr;
+		sf_parse_status status;
+	};
+
+	namespace detail {
+
+		/**
+		 * Decimal digits of 2^x, so 10^pow2_digits10(x) > 2^x.
+		 * 0.30103 is slightly above log10(2), so it is never too low.
+		 */
+		constexpr uint pow2_digits10(int x) {
+			return x <= 0 ? 1 : uint(uint64_t(x)*30103/100000) + 1;
+		}
+
+		/**
+		 * Unsigned integer of L 32 bit limbs, least significant first.
+		 * Only operations needed for decimal conversion,
+		 * of numbers wider than unsigned __int128.
+		 */
+		template<uint L>
+		struct dec_uint {
+			static_assert(L >= 4, "Narrower numbers are in unsigned __int128!");
+
+			uint32_t w[L];
+
+			dec_uint(uint64_t v = 0) {
+				w[0] = uint32_t(v);
+				w[1] = uint32_t(v >> 32);
+				for(uint i = 2; i < L; i++){
+					w[i] = 0;
+				}
+			}
+
+			static dec_uint from128(uint128_t v) {
+				dec_uint r;
+				for(uint i = 0; i < 4; i++){
+					r.w[i] = uint32_t(v >> (32*i));
+				}
+				return r;
+			}
+
+			uint128_t low128() const {
+				uint128_t v = 0;
+				for(uint i = 0; i < 4; i++){
+					v |= uint128_t(w[i]) << (32*i);
+				}
+				return v;
+			}
+
+			friend dec_uint operator*(const dec_uint& a, uint32_t m) {
+				dec_uint r;
+				uint64_t c = 0;
+				for(uint i = 0; i < L; i++){
+					c += uint64_t(a.w[i])*m;
+					r.w[i] = uint32_t(c);
+					c >>= 32;
+				}
+				return r;
+			}
+
+			friend dec_uint operator+(const dec_uint& a, const dec_uint& b) {
+				dec_uint r;
+				uint64_t c = 0;
+				for(uint i = 0; i < L; i++){
+					c += uint64_t(a.w[i]) + b.w[i];
+					r.w[i] = uint32_t(c);
+					c >>= 32;
+				}
+				return r;
+			}
+
+			/// a - b for a >= b.
+			friend dec_uint operator-(const dec_uint& a, const dec_uint& b) {
+				dec_uint r;
+				uint64_t borrow = 0;
+				for(uint i = 0; i < L; i++){
+					const uint64_t d = uint64_t(a.w[i]) - b.w[i] - borrow;
+					r.w[i] = uint32_t(d);
+					borrow = d >> 63;
+				}
+				return r;
+			}
+
+			friend dec_uint operator<<(const dec_uint& a, uint s) {
+				dec_uint r;
+				const uint q = s/32, b = s % 32;
+				for(uint i = L; i-- > 0;){
+					uint32_t v = 0;
+					if(i >= q){
+						v = a.w[i - q] << b;
+						if(b && i > q){
+							v |= a.w[i - q - 1] >> (32 - b);
+						}
+					}
+					r.w[i] = v;
+				}
+				return r;
+			}
+
+			friend dec_uint operator>>(const dec_uint& a, uint s) {
+				dec_uint r;
+				const uint q = s/32, b = s % 32;
+				for(uint i = 0; i < L; i++){
+					uint32_t v = 0;
+					if(i + q < L){
+						v = a.w[i + q] >> b;
+						if(b && i + q + 1 < L){
+							v |= a.w[i + q + 1] << (32 - b);
+						}
+					}
+					r.w[i] = v;
+				}
+				return r;
+			}
+
+			friend bool operator<(const dec_uint& a, const dec_uint& b) {
+				for(uint i = L; i-- > 0;){
+					if(a.w[i] != b.w[i]){
+						return a.w[i] < b.w[i];
+					}
+				}
+				return false;
+			}
+
+			friend bool operator==(const dec_uint& a, const dec_uint& b) {
+				for(uint i = 0; i < L; i++){
+					if(a.w[i] != b.w[i]){
+						return false;
+					}
+				}
+				return true;
+			}
+
+			friend bool operator!=(const dec_uint& a, const dec_uint& b) {
+				return !(a == b);
+			}
+		};
+
+		template<uint L>
+		dec_uint<L> divmod(const dec_uint<L>& a, uint32_t d, uint32_t& rem) {
+			dec_uint<L> q;
+			uint64_t r = 0;
+			for(uint i = L; i-- > 0;){
+				r = (r << 32) | a.w[i];
+				q.w[i] = uint32_t(r/d);
+				r %= d;
+			}
+			rem = uint32_t(r);
+			return q;
+		}
+
+		inline uint128_t divmod(const uint128_t& a, uint32_t d, uint32_t& rem) {
+			rem = uint32_t(a % d);
+			return a/d;
+		}
+
+		inline uint64_t divmod(const uint64_t& a, uint32_t d, uint32_t& rem) {
+			rem = uint32_t(a % d);
+			return a/d;
+		}
+
+		template<uint L>
+		bool fits64(const dec_uint<L>& a) {
+			for(uint i = 2; i < L; i++){
+				if(a.w[i]){
+					return false;
+				}
+			}
+			return true;
+		}
+
+		inline bool fits64(const uint128_t& a) {
+			return (a >> 64) == 0;
+		}
+
+		inline bool fits64(const uint64_t&) {
+			return true;
+		}
+
+		template<uint L>
+		uint64_t low64(const dec_uint<L>& a) {
+			return a.w[0] | uint64_t(a.w[1]) << 32;
+		}
+
+		inline uint64_t low64(const uint128_t& a) {
+			return uint64_t(a);
+		}
+
+		inline uint64_t low64(const uint64_t& a) {
+			return a;
+		}
+
+		template<typename W>
+		W wide_from128(uint128_t v) {
+			return W::from128(v);
+		}
+
+		template<>
+		inline uint128_t wide_from128<uint128_t>(uint128_t v) {
+			return v;
+		}
+
+		/// Value must fit in 64 bits.
+		template<>
+		inline uint64_t wide_from128<uint64_t>(uint128_t v) {
+			return uint64_t(v);
+		}
+
+		template<uint L>
+		uint128_t wide_low128(const dec_uint<L>& a) {
+			return a.low128();
+		}
+
+		template<typename W>
+		uint128_t wide_low128(const W& a) {
+			return a;
+		}
+
+		/**
+		 * Unsigned integer of at least Bits bits.
+		 */
+		template<uint Bits>
+		struct dec_wide {
+			typedef typename std::conditional<
+				Bits <= 63,
+				uint64_t,
+				typename std::conditional<
+					Bits <= 127,
+					uint128_t,
+					dec_uint<(Bits + 31)/32>
+				>::type
+			>::type type;
+		};
+
+		constexpr uint32_t dec_pow10[10] = {
+			1, 10, 100, 1000, 10000, 100000,
+			1000000, 10000000, 100000000, 1000000000
+		};
+
+		constexpr uint64_t dec_pow10_64[20] = {
+			1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull,
+			1000000ull, 10000000ull, 100000000ull, 1000000000ull,
+			10000000000ull, 100000000000ull, 1000000000000ull,
+			10000000000000ull, 100000000000000ull, 1000000000000000ull,
+			10000000000000000ull, 100000000000000000ull,
+			1000000000000000000ull, 10000000000000000000ull
+		};
+
+		template<typename W>
+		void mul_pow10(W& a, uint d) {
+			for(; d >= 9; d -= 9){
+				a = a*dec_pow10[9];
+			}
+			a = a*dec_pow10[d];
+		}
+
+		inline void mul_pow10(uint128_t& a, uint d) {
+			for(; d >= 19; d -= 19){
+				a *= dec_pow10_64[19];
+			}
+			a *= dec_pow10_64[d];
+		}
+
+		/// Product must fit in 64 bits.
+		inline void mul_pow10(uint64_t& a, uint d) {
+			a *= dec_pow10_64[d];
+		}
+
+		/**
+		 * a = floor(a/10^d), and inexact is set if remainder is not 0.
+		 */
+		template<typename W>
+		void div_pow10(W& a, uint d, bool& inexact) {
+			uint32_t r;
+			for(; d >= 9; d -= 9){
+				a = divmod(a, dec_pow10[9], r);
+				inexact |= r != 0;
+			}
+			a = divmod(a, dec_pow10[d], r);
+			inexact |= r != 0;
+		}
+
+		inline void div_pow10(uint128_t& a, uint d, bool& inexact) {
+			for(; d > 0;){
+				const uint c = d < 19 ? d : 19;
+				const uint64_t p = dec_pow10_64[c];
+				const uint128_t q = a/p;
+				inexact |= q*p != a;
+				a = q;
+				d -= c;
+			}
+		}
+
+		inline void div_pow10(uint64_t& a, uint d, bool& inexact) {
+			if(d > 19){
+				inexact |= a != 0;
+				a = 0;
+				return;
+			}
+			const uint64_t q = a/dec_pow10_64[d];
+			inexact |= q*dec_pow10_64[d] != a;
+			a = q;
+		}
+
+		/**
+		 * Write v/10^frac, with frac digits after point,
+		 * and 0 before point if it is below 1.
+		 * Digits are written backward at their places.
+		 * @return end of written chars
+		 */
+		inline char* write_fixed(char* p, uint64_t v, uint frac) {
+			uint n = 1;
+			while(n < 20 && v >= dec_pow10_64[n]){
+				n++;
+			}
+			char* end = p + (n > frac ? n + (frac ? 1 : 0) : frac + 2);
+			char* q = end;
+			for(uint i = 0; i < frac; i++){
+				*--q = char('0' + v % 10);
+				v /= 10;
+			}
+			if(frac){
+				*--q = '.';
+			}
+			do{
+				*--q = char('0' + v % 10);
+				v /= 10;
+			}while(v);
+			return end;
+		}
+
+		template<typename W>
+		char* write_fixed(char* p, const W& v, uint frac) {
+			if(fits64(v)){
+				return write_fixed(p, low64(v), frac);
+			}
+			// Digits of wide v by 9, to buffer.
+			char buf[(sizeof(W)*8*3 + 9)/9*10];
+			char* end = buf + sizeof(buf);
+			char* d = end;
+			W a = v;
+			while(!fits64(a)){
+				uint32_t r;
+				a = divmod(a, dec_pow10[9], r);
+				for(uint i = 0; i < 9; i++){
+					*--d = char('0' + r % 10);
+					r /= 10;
+				}
+			}
+			for(uint64_t l = low64(a); l; l /= 10){
+				*--d = char('0' + l % 10);
+			}
+			const uint n = uint(end - d);
+			if(n <= frac){
+				*p++ = '0';
+				*p++ = '.';
+				for(uint i = n; i < frac; i++){
+					*p++ = '0';
+				}
+				memcpy(p, d, n);
+				return p + n;
+			}
+			memcpy(p, d, n - frac);
+			p += n - frac;
+			if(frac){
+				*p++ = '.';
+				memcpy(p, d + n - frac, frac);
+				p += frac;
+			}
+			return p;
+		}
+
+		////////////////////////////////////
+
+		/**
+		 * Sizes of decimal conversion of T.
+		 */
+		template<typename T>
+		struct decimal_traits {
+			static constexpr int e = T::e;
+			static constexpr uint b = T::b;
+			static constexpr uint k = e < 0 ? uint(-e) : 0;
+			static constexpr uint ush = e > 0 ? uint(e) : 0;
+			static constexpr bool is_signed = is_signed_type((T*)nullptr);
+			/// Fraction digits, which are enough for any value.
+			static constexpr uint max_frac = pow2_digits10(int(k));
+			/// Digits of integer part.
+			static constexpr uint int_digits = pow2_digits10(int(b) + e);
+			/// Sign, integer digits, point and fraction digits.
+			static constexpr uint max_chars = 2 + int_digits + (k ? max_frac : 0);
+
+			/**
+			 * Value times 10^d or candidate times 2^k,
+			 * d <= max_frac, so 10^d < 2^(k + 1)*10.
+			 */
+			static constexpr uint format_bits = b + ush + (k ? k + k/64 + 8 : 1);
+			typedef typename dec_wide<format_bits>::type format_type;
+
+			/// Fraction digits which could change rounding.
+			static constexpr uint frac_digits = k + 1;
+			/// Significant digits of parsed value which are kept.
+			static constexpr uint keep_digits = int_digits + frac_digits + 1;
+			/// 2*value*2^k in ulps, value below 10^int_digits.
+			static constexpr uint parse_bits =
+				(keep_digits > int_digits ? keep_digits : int_digits)*10/3 + k + 8;
+			typedef typename dec_wide<parse_bits>::type parse_type;
+		};
+
+		/**
+		 * Magnitude of n to m.
+		 * @return true if n is negative
+		 */
+		template<typename N, typename W>
+		bool dec_load(const N& n, W& m) {
+			const bool neg = n < N(0);
+			m = wide_from128<W>(neg ? uint128_t(0) - uint128_t(n) : uint128_t(n));
+			return neg;
+		}
+
+		template<typename N, typename W>
+		void dec_store(const W& m, bool neg, N& n) {
+			const uint128_t v = wide_low128(m);
+			n = neg ? N(uint128_t(0) - v) : N(v);
+		}
+
+#ifdef HAVE_GMP
+		template<uint L>
+		bool dec_load_mpz(const mpz_class& n, dec_uint<L>& m) {
+			m = dec_uint<L>();
+			mpz_export(m.w, nullptr, -1, 4, 0, 0, n.get_mpz_t());
+			return sgn(n) < 0;
+		}
+
+		template<uint L>
+		void dec_store_mpz(const dec_uint<L>& m, bool neg, mpz_class& n) {
+			mpz_import(n.get_mpz_t(), L, -1, 4, 0, 0, m.w);
+			if(neg){
+				n = -n;
+			}
+		}
+
+		template<typename W>
+		bool dec_load(const int_big_t& n, W& m) {
+			return dec_load_mpz(n, m);
+		}
+
+		template<typename W>
+		bool dec_load(const uint_big_t& n, W& m) {
+			return dec_load_mpz(n, m);
+		}
+
+		template<typename W>
+		void dec_store(const W& m, bool neg, int_big_t& n) {
+			dec_store_mpz(m, neg, n);
+		}
+
+		template<typename W>
+		void dec_store(const W& m, bool neg, uint_big_t& n) {
+			dec_store_mpz(m, neg, n);
+		}
+#endif
+
+		/**
+		 * Write shortest decimal of x, which is read back to x.
+		 * p must have room for decimal_traits<T>::max_chars.
+		 * @return end of written chars
+		 */
+		template<typename T>
+		char* format_decimal(char* p, const T& x) {
+			typedef decimal_traits<T> tr;
+			typedef typename tr::format_type W;
+			W a;
+			const bool neg = dec_load(x.num, a);
+			if(a == W(0)){
+				*p++ = '0';
+				return p;
+			}
+			if(neg){
+				*p++ = '-';
+			}
+			if(!tr::k){
+				return write_fixed(p, W(a << tr::ush), 0);
+			}
+
+			// Rounding to d fraction digits reads back to a
+			// if it is within half of ulp, |c*2^k - a*10^d| < 10^d/2.
+			// Error only gets smaller with more digits,
+			// so d goes down from max_frac, which is always enough.
+			const uint k = tr::k;
+			const W half = W(1) << (k ? k - 1 : 0);
+			W ad = a;
+			mul_pow10(ad, tr::max_frac);
+			W best = (ad + half) >> k;
+			uint best_d = tr::max_frac;
+			for(uint d = tr::max_frac; d-- > 0;){
+				ad = a;
+				mul_pow10(ad, d);
+				const W c = (ad + half) >> k;
+				const W back = c << k;
+				const W err = back < ad ? W(ad - back) : W(back - ad);
+				W ulp = W(1);
+				mul_pow10(ulp, d);
+				if(!(err + err < ulp)){
+					break;
+				}
+				best = c;
+				best_d = d;
+			}
+
+			return write_fixed(p, best, best_d);
+		}
+
+		/**
+		 * Round digits*10^dexp to x, in arithmetic of W.
+		 * @param d19 first 19 digits as integer
+		 * @param sticky if dropped digits after digits are not 0
+		 */
+		template<typename W, typename T>
+		sf_parse_status parse_decimal(
+			const uint8_t* digits,
+			uint nd,
+			uint64_t d19,
+			int64_t dexp,
+			bool sticky,
+			bool neg,
+			T& x
+		) {
+			typedef decimal_traits<T> tr;
+			typedef typename T::num_type nt;
+			// Digits of integer part.
+			const int64_t top = int64_t(nd) + dexp;
+			W m = W(0);
+			if(nd == 0 || top < -int64_t(tr::frac_digits)){
+				// Below half of ulp.
+			}else if(top > int64_t(tr::int_digits)){
+				// Above any value in range.
+				m = (W(1) << tr::b) + W(1);
+			}else{
+				W v = W(d19);
+				uint i = nd <= 19 ? nd : 0;
+				if(i == 0){
+					v = W(0);
+				}
+				for(; i + 9 <= nd; i += 9){
+					uint32_t c = 0;
+					for(uint j = 0; j < 9; j++){
+						c = c*10 + digits[i + j];
+					}
+					v = v*dec_pow10[9] + W(c);
+				}
+				if(i < nd){
+					uint32_t c = 0;
+					for(uint j = i; j < nd; j++){
+						c = c*10 + digits[j];
+					}
+					v = v*dec_pow10[nd - i] + W(c);
+				}
+
+				// z = floor(2*value*2^k), value in ulps.
+				bool inexact = sticky;
+				if(dexp >= 0){
+					mul_pow10(v, uint(dexp));
+				}
+				v = v << (tr::k + 1);
+				if(tr::ush){
+					const W q = v >> tr::ush;
+					inexact |= (q << tr::ush) != v;
+					v = q;
+				}
+				if(dexp < 0){
+					div_pow10(v, uint(-dexp), inexact);
+				}
+				// Positive value is floor(z/2 + 1/2), negative -ceil(z/2 - 1/2).
+				m = neg && !inexact ? W(v >> 1) : W((v + W(1)) >> 1);
+			}
+
+			// Magnitude of max, or of min for negative.
+			const W lim = neg
+				? tr::is_signed ? W(1) << tr::b : W(0)
+				: (W(1) << tr::b) - W(1);
+			sf_parse_status status = sf_parse_ok;
+			if(lim < m){
+				m = lim;
+				status = sf_parse_out_of_range;
+			}
+			nt n;
+			dec_store(m, neg, n);
+			x.num = n;
+			return status;
+		}
+
+		inline bool is_digit(char c) {
+			return uint(c - '0') < 10;
+		}
+
+	} // namespace detail
+
+	////////////////////////////////////
+
+	/**
+	 * Max count of chars written by to_chars() for T.
+	 */
+	template<typename T>
+	constexpr uint max_decimal_chars() {
+		return detail::decimal_traits<T>::max_chars;
+	}
+
+	/**
+	 * Write shortest decimal of x, which from_chars() reads back to x,
+	 * ie. "-0.00003" for sf<15, -15> of num -1, without terminating zero.
+	 * @return end of written chars, or nullptr if there is no room
+	 */
+	template<typename T>
+	char* to_chars(char* first, char* last, const T& x) {
+		constexpr uint max = max_decimal_chars<T>();
+		if(size_t(last - first) >= max){
+			return detail::format_decimal(first, x);
+		}
+		char buf[max];
+		const size_t n = size_t(detail::format_decimal(buf, x) - buf);
+		if(n > size_t(last - first)){
+			return nullptr;
+		}
+		memcpy(first, buf, n);
+		return first + n;
+	}
+
+	/**
+	 * Read decimal [+-]digits[.digits][(e|E)[+-]digits] to x,
+	 * rounded to nearest num, halves toward +inf, and saturated.
+	 * Any count of digits is rounded correctly.
+	 */
+	template<typename T>
+	sf_parse_result from_chars(const char* first, const char* last, T& x) {
+		typedef detail::decimal_traits<T> tr;
+		using detail::is_digit;
+
+		const char* p = first;
+		bool neg = false;
+		if(p != last && (*p == '-' || *p == '+')){
+			neg = *p == '-';
+			p++;
+		}
+
+		// Value is digits*10^dexp, sticky if any dropped digit is not 0.
+		// Dropped digits are below frac_digits of any value in range,
+		// so they could only tell that value is above midpoint.
+		uint8_t digits[tr::keep_digits];
+		uint nd = 0;
+		// First 19 digits, as integer.
+		uint64_t d19 = 0;
+		int64_t dexp = 0;
+		bool sticky = false;
+		bool any = false;
+		for(; p != last && is_digit(*p); p++){
+			any = true;
+			const uint8_t c = uint8_t(*p - '0');
+			if(nd == 0 && c == 0){
+			}else if(nd < tr::keep_digits){
+				d19 = nd < 19 ? d19*10 + c : d19;
+				digits[nd++] = c;
+			}else{
+				dexp++;
+				sticky |= c != 0;
+			}
+		}
+		if(p != last && *p == '.'){
+			p++;
+			for(; p != last && is_digit(*p); p++){
+				any = true;
+				const uint8_t c = uint8_t(*p - '0');
+				if(nd == 0 && c == 0){
+					dexp--;
+				}else if(nd < tr::keep_digits){
+					d19 = nd < 19 ? d19*10 + c : d19;
+					digits[nd++] = c;
+					dexp--;
+				}else{
+					sticky |= c != 0;
+				}
+			}
+		}
+		if(!any){
+			return sf_parse_result{first, sf_parse_invalid};
+		}
+		if(p != last && (*p == 'e' || *p == 'E')){
+			const char* q = p + 1;
+			bool eneg = false;
+			if(q != last && (*q == '-' || *q == '+')){
+				eneg = *q == '-';
+				q++;
+			}
+			if(q != last && is_digit(*q)){
+				int64_t ex = 0;
+				for(; q != last && is_digit(*q); q++){
+					ex = ex < 1000000 ? ex*10 + (*q - '0') : ex;
+				}
+				dexp += eneg ? -ex : ex;
+				p = q;
+			}
+		}
+
+		// Short decimal fits in 64 bits, longer in parse_type.
+		// Fine types shift by k + 1 more than 64 bits could hold.
+		typedef typename std::conditional<
+			(tr::b < 62 && tr::k + 8 <= 63),
+			uint64_t,
+			typename tr::parse_type
+		>::type fast_type;
+		const int64_t top = int64_t(nd) + dexp;
+		const int64_t bits = (dexp >= 0 ? top : int64_t(nd))*10/3 + tr::k + 2;
+		const sf_parse_status status = bits <= 63 && top <= int64_t(tr::int_digits)
+			? detail::parse_decimal<fast_type>(digits, nd, d19, dexp, sticky, neg, x)
+			: detail::parse_decimal<typename tr::parse_type>(
+				digits, nd, d19, dexp, sticky, neg, x
+			);
+		return sf_parse_result{p, status};
+	}
+
+	////////////////////////////////////
+
+	/**
+	 * Write n values, each followed by delim,
+	 * to out of at least n*(max_decimal_chars<T>() + 1) chars.
+	 * @return end of written chars
+	 */
+	template<typename T>
+	char* format_csv_column(const T* x, size_t n, char* out, char delim = '\n') {
+		for(size_t i = 0; i < n; i++){
+			out = detail::format_decimal(out, x[i]);
+			*out++ = delim;
+		}
+		return out;
+	}
+
+	/**
+	 * Read field column of up to n rows of CSV text to out.
+	 * Values are rounded and saturated as in from_chars().
+	 * Throws format_error if field is not number.
+	 * @return count of rows read
+	 */
+	template<typename T>
+	size_t parse_csv_column(
+		const char* first,
+		const char* last,
+		T* out,
+		size_t n,
+		uint column = 0,
+		char delim = ','
+	) {
+		const char* p = first;
+		size_t row = 0;
+		for(; row < n && p != last; row++){
+			for(uint c = 0; c < column; c++){
+				while(p != last && *p != delim && *p != '\n'){
+					p++;
+				}
+				if(p == last || *p == '\n'){
+					throw exceptions::format_error()
+						<< "No column " << column << " in row " << row
+						<< exceptions::endl;
+				}
+				p++;
+			}
+			while(p != last && *p == ' '){
+				p++;
+			}
+			const sf_parse_result r = from_chars(p, last, out[row]);
+			p = r.ptr;
+			while(p != last && *p == ' '){
+				p++;
+			}
+			if(
+				r.status == sf_parse_invalid
+				|| (p != last && *p != delim && *p != '\n' && *p != '\r')
+			){
+				throw exceptions::format_error()
+					<< "Column " << column << " of row " << row
+					<< " is not number" << exceptions::endl;
+			}
+			if(p != last && *p == '\n'){
+				p++;
+			}else{
+				const char* e = static_cast<const char*>(
+					memchr(p, '\n', size_t(last - p))
+				);
+				p = e ? e + 1 : last;
+			}
+		}
+		return row;
+	}
+
+	////////////////////////////////////
+
+	/**
+	 * Exact shortest decimal of x.
+	 */
+	template<uint B, int E>
+	std::ostream& operator<<(std::ostream& os, const sf<B, E>& x) {
+		char buf[max_decimal_chars<sf<B, E>>()];
+		return os.write(buf, detail::format_decimal(buf, x) - buf);
+	}
+
+	template<uint B, int E>
+	std::ostream& operator<<(std::ostream& os, const usf<B, E>& x) {
+		char buf[max_decimal_chars<usf<B, E>>()];
+		return os.write(buf, detail::format_decimal(buf, x) - buf);
+	}
+
+	////////////////////////////////////
+
+} // namespace static_float
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // STATIC_FLOAT_DECIMAL_H_
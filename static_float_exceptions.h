@@ -147,6 +147,18 @@ namespace static_float {
 			virtual ~sign_error() noexcept {}
 		};
 
+		class io_error : public runtime_error {
+		public:
+			explicit io_error() {}
+			virtual ~io_error() noexcept {}
+		};
+
+		class format_error : public runtime_error {
+		public:
+			explicit format_error() {}
+			virtual ~format_error() noexcept {}
+		};
+
 	} // namespace exceptions
 
 } // namespace static_float
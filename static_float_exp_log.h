@@ -0,0 +1,470 @@
+/**
+ * @file static_float_exp_log.h
+ * @date Oct 19, 2026
+ *
+ * @author Milos Subotic <milos.subotic.sm@gmail.com>
+ * @license MIT
+ *
+ * @brief Exponentials and logarithms of static floats,
+ * with table and quadratic polynomial.
+ *
+ * @version 1.0
+ * Changelog:
+ * 1.0 - Initial version.
+ *
+ */
+
+#ifndef STATIC_FLOAT_EXP_LOG_H_
+#define STATIC_FLOAT_EXP_LOG_H_
+
+///////////////////////////////////////////////////////////////////////////////
+
+#include "static_float.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+namespace static_float {
+
+	namespace detail {
+
+		constexpr long double ln2_ld = 0.693147180559945309417232121458176568L;
+		constexpr long double log2e_ld = 1.44269504088896340735992468100189214L;
+
+		/**
+		 * Series of atanh(z) = z + z^3/3 + z^5/5 + ..., from term k on.
+		 * p is z^(2k+1).
+		 */
+		constexpr long double atanh_series(long double z2, long double p, uint k) {
+			return p < 1e-40L
+				? 0.0L
+				: p/(2*k + 1) + atanh_series(z2, p*z2, k + 1);
+		}
+
+		/**
+		 * @return log2(y) for y in [1, 2], ln(y) = 2*atanh((y-1)/(y+1)).
+		 */
+		constexpr long double log2_ld(long double y) {
+			return 2*atanh_series(
+				(y - 1)/(y + 1)*(y - 1)/(y + 1),
+				(y - 1)/(y + 1),
+				0
+			)/ln2_ld;
+		}
+
+		/**
+		 * Series of e^a from term k on, t is a^k/k!.
+		 */
+		constexpr long double exp_series(long double a, long double t, uint k) {
+			return t < 1e-40L ? 0.0L : t + exp_series(a, t*a/(k + 1), k + 1);
+		}
+
+		/**
+		 * @return 2^f for f in [0, 1].
+		 */
+		constexpr long double exp2_ld(long double f) {
+			return exp_series(f*ln2_ld, 1.0L, 0);
+		}
+
+		constexpr int64_t ceil_ld(long double v) {
+			return int64_t(v) + (v > int64_t(v) ? 1 : 0);
+		}
+
+		/// Fraction bits of table, mantissas and logarithms.
+		constexpr uint exp_log_q = 30;
+
+		/// log2(1 + u) for u in [0, 1].
+		struct log2_fn {
+			static constexpr long double f(long double u) {
+				return log2_ld(1 + u);
+			}
+		};
+
+		/// 2^u for u in [0, 1].
+		struct exp2_fn {
+			static constexpr long double f(long double u) {
+				return exp2_ld(u);
+			}
+		};
+
+		/**
+		 * Function F on [0, 1) in 2^T segments,
+		 * with quadratic polynomial through ends and middle of segment.
+		 * Coefficients have exp_log_q fraction bits.
+		 */
+		template<typename F, uint T>
+		struct poly2_table {
+			static constexpr uint n = 1u << T;
+			static constexpr uint RB = exp_log_q - T;
+
+			static constexpr long double at(uint i, long double u) {
+				return F::f((i + u)/n);
+			}
+
+			/// Coefficient j of segment i, from values f0, fm and f1.
+			static constexpr long double coef(uint i, uint j) {
+				return j == 0
+					? at(i, 0)
+					: j == 1
+						? -3*at(i, 0) + 4*at(i, 0.5L) - at(i, 1)
+						: 2*at(i, 0) - 4*at(i, 0.5L) + 2*at(i, 1);
+			}
+
+			template<uint I, uint J>
+			struct c {
+				static constexpr int64_t value =
+					round_ld(coef(I, J)*pow2(exp_log_q));
+				static_assert(
+					value == int32_t(value),
+					"Coefficient is out of 32 bits!"
+				);
+			};
+
+			/**
+			 * Coefficients are in separate 32 bit arrays,
+			 * because gcc gathers only with index of same width.
+			 */
+			template<typename S>
+			struct table_impl;
+
+			template<uint... I>
+			struct table_impl<index_seq<I...>> {
+				static const int32_t c0[n];
+				static const int32_t c1[n];
+				static const int32_t c2[n];
+			};
+
+			typedef table_impl<typename make_index_seq<n>::type> table;
+
+			/**
+			 * @param x in [0, 1) with exp_log_q fraction bits
+			 * @return F(x) with exp_log_q fraction bits
+			 */
+			static int64_t eval(int64_t x) {
+				const int k = int(x >> RB);
+				const int64_t r = x & ((int64_t(1) << RB) - 1);
+				int64_t acc = table::c2[k];
+				acc = table::c1[k] + ((acc*r) >> RB);
+				acc = table::c0[k] + ((acc*r) >> RB);
+				return acc;
+			}
+		};
+
+		template<typename F, uint T>
+		template<uint... I>
+		const int32_t poly2_table<F, T>::table_impl<index_seq<I...>>::c0[n]
+			= { poly2_table<F, T>::c<I, 0>::value... };
+
+		template<typename F, uint T>
+		template<uint... I>
+		const int32_t poly2_table<F, T>::table_impl<index_seq<I...>>::c1[n]
+			= { poly2_table<F, T>::c<I, 1>::value... };
+
+		template<typename F, uint T>
+		template<uint... I>
+		const int32_t poly2_table<F, T>::table_impl<index_seq<I...>>::c2[n]
+			= { poly2_table<F, T>::c<I, 2>::value... };
+
+		/// Error of 128 segments is below 2^-26.
+		typedef poly2_table<log2_fn, 7> log2_table;
+		typedef poly2_table<exp2_fn, 7> exp2_table;
+
+		/**
+		 * @return log2(num*2^E) with exp_log_q fraction bits, for num > 0
+		 */
+		template<int E>
+		inline int64_t log2_q(uint64_t num) {
+			constexpr uint Q = exp_log_q;
+			const int p = 63 - __builtin_clzll(num);
+			// Mantissa in [1, 2), leading zeros are normalized.
+			const int64_t m = p >= int(Q)
+				? int64_t(num >> (p - int(Q)))
+				: int64_t(num << (int(Q) - p));
+			return (int64_t(p + E) << Q)
+				+ log2_table::eval(m - (int64_t(1) << Q));
+		}
+
+		/**
+		 * 2^(v*2^-FI) as num with FO fraction bits, rounded.
+		 * Result is below 2^H.
+		 */
+		template<uint FI, int FO, uint H>
+		inline uint64_t exp2_q(int64_t v) {
+			constexpr int Q = exp_log_q;
+			// Mantissa is pre-shifted, so it is only right shifted,
+			// for at least 1 bit, without branches.
+			constexpr int P = int(H) + FO - Q + 1 > 0 ? int(H) + FO - Q + 1 : 0;
+			static_assert(Q + 1 + P < 64, "Result of exp2() is too wide!");
+			const int64_t i = v >> FI;
+			const int64_t f = v & ((int64_t(1) << FI) - 1);
+			const int64_t fq = FI >= uint(Q)
+				? f >> (FI >= uint(Q) ? FI - Q : 0)
+				: f << (FI >= uint(Q) ? 0 : Q - FI);
+			const uint64_t m = uint64_t(exp2_table::eval(fq)) << P;
+			int64_t s = Q + P - FO - i;
+			s = s < 63 ? s : 63;
+			// Same as adding half, without variable shift of constant.
+			return ((m >> (s - 1)) + 1) >> 1;
+		}
+
+		/**
+		 * Integer bits of logarithms and exponentials of static float
+		 * with B bits and exponent E.
+		 */
+		template<uint B, int E>
+		struct exp_log_bits {
+			/// Integer bits of argument.
+			static constexpr int IA = int(B) + E;
+			/// Largest magnitude of log2() is at ends of range.
+			static constexpr uint64_t L2 =
+				uint64_t(rt::max(E < 0 ? -E : E, IA < 0 ? -IA : IA));
+			static constexpr uint log2_ib = bit_width(L2);
+			static constexpr uint log_ib = bit_width(uint64_t(L2*ln2_ld));
+			/// Integer bits of 2^x and e^x.
+			static constexpr uint exp2_h = uint(ceil_ld(
+				IA >= 0 ? pow2(uint(IA)) : pow2_neg(uint(-IA))
+			));
+			static constexpr uint exp_h = uint(ceil_ld(
+				(IA >= 0 ? pow2(uint(IA)) : pow2_neg(uint(-IA)))*log2e_ld
+			));
+		};
+
+	} // namespace detail
+
+	////////////////////////////////////
+
+} // namespace static_float
+
+
+namespace rt {
+
+	/**
+	 * Logarithm have same bits as argument, without bits of integer part.
+	 * Fraction bits are limited by precision of table.
+	 */
+	template<uint B, int E>
+	struct log2<static_float::usf<B, E>> {
+		static constexpr uint ib = static_float::detail::exp_log_bits<B, E>::log2_ib;
+		static_assert(B > ib, "Argument of log2() is too narrow!");
+		static_assert(B - ib <= 24, "Result of log2() is too precise!");
+		typedef static_float::sf<B, int(ib) - int(B)> rt;
+	};
+
+	template<uint B, int E>
+	struct log2<static_float::sf<B, E>> : log2<static_float::usf<B, E>> {
+	};
+
+	template<uint B, int E>
+	struct log<static_float::usf<B, E>> {
+		static constexpr uint ib = static_float::detail::exp_log_bits<B, E>::log_ib;
+		static_assert(B > ib, "Argument of log() is too narrow!");
+		static_assert(B - ib <= 24, "Result of log() is too precise!");
+		typedef static_float::sf<B, int(ib) - int(B)> rt;
+	};
+
+	template<uint B, int E>
+	struct log<static_float::sf<B, E>> : log<static_float::usf<B, E>> {
+	};
+
+	/**
+	 * Exponential have same exponent as argument,
+	 * and integer bits for largest result.
+	 */
+	template<uint B, int E>
+	struct exp2<static_float::sf<B, E>> {
+		static constexpr uint h = static_float::detail::exp_log_bits<B, E>::exp2_h;
+		static_assert(int(h) - E <= 25, "Result of exp2() is too wide!");
+		typedef static_float::usf<uint(int(h) - E), E> rt;
+	};
+
+	template<uint B, int E>
+	struct exp2<static_float::usf<B, E>> : exp2<static_float::sf<B, E>> {
+	};
+
+	template<uint B, int E>
+	struct exp<static_float::sf<B, E>> {
+		static constexpr uint h = static_float::detail::exp_log_bits<B, E>::exp_h;
+		static_assert(int(h) - E <= 25, "Result of exp() is too wide!");
+		static_assert(E < 30, "Argument of exp() is too coarse!");
+		typedef static_float::usf<uint(int(h) - E), E> rt;
+	};
+
+	template<uint B, int E>
+	struct exp<static_float::usf<B, E>> : exp<static_float::sf<B, E>> {
+	};
+
+} // namespace rt
+
+
+namespace static_float {
+
+	namespace detail {
+
+		/**
+		 * Logarithm of positive num*2^E, rounded to type T.
+		 * Non-positive arguments give smallest value of T, as -infinity.
+		 */
+		template<typename T, int E, typename N>
+		inline T log2_impl(N num) {
+			constexpr uint SH = exp_log_q - uint(-T::e);
+			// Without branch, so batch loops are vectorized.
+			const int64_t l = log2_q<E>(uint64_t(num > 0 ? num : 1));
+			T r;
+			r.num = num > 0
+				? typename T::num_type(round_shift<round_nearest, SH>(l))
+				: typename T::num_type(-(int64_t(1) << T::b));
+			return r;
+		}
+
+		template<typename T, int E, typename N>
+		inline T log_impl(N num) {
+			constexpr uint Q = exp_log_q;
+			constexpr uint SH = Q - uint(-T::e);
+			constexpr int64_t ln2 = round_ld(ln2_ld*pow2(Q));
+			const int64_t l2 = log2_q<E>(uint64_t(num > 0 ? num : 1));
+			// Product in two halves, to stay in 64 bits.
+			const int64_t hi = l2 >> (Q/2);
+			const int64_t lo = l2 & ((int64_t(1) << (Q/2)) - 1);
+			const int64_t l = ((hi*ln2) >> (Q/2)) + ((lo*ln2) >> Q);
+			T r;
+			r.num = num > 0
+				? typename T::num_type(round_shift<round_nearest, SH>(l))
+				: typename T::num_type(-(int64_t(1) << T::b));
+			return r;
+		}
+
+		template<typename T, int E, typename N>
+		inline T exp2_impl(N num) {
+			constexpr uint FI = E < 0 ? uint(-E) : 0;
+			const int64_t v = E > 0
+				? int64_t(num) << (E > 0 ? E : 0)
+				: int64_t(num);
+			T r;
+			r.num = typename T::num_type(exp2_q<FI, -T::e, T::b + T::e>(v));
+			return r;
+		}
+
+		template<typename T, int E, typename N>
+		inline T exp_impl(N num) {
+			constexpr uint Q = exp_log_q;
+			constexpr int64_t log2e = round_ld(log2e_ld*pow2(Q));
+			T r;
+			r.num = typename T::num_type(
+				exp2_q<uint(int(Q) - E), -T::e, T::b + T::e>(int64_t(num)*log2e)
+			);
+			return r;
+		}
+
+	} // namespace detail
+
+	////////////////////////////////////
+
+	/**
+	 * Logarithms from leading zero normalization of argument,
+	 * and mantissa from table with quadratic polynomial.
+	 * Error is at most epsilon of result type.
+	 * Logarithm of zero or negative number is smallest value of result.
+	 */
+	template<uint B, int E>
+	typename rt::log2<usf<B, E>>::rt log2(const usf<B, E>& x) {
+		return detail::log2_impl<typename rt::log2<usf<B, E>>::rt, E>(x.num);
+	}
+
+	template<uint B, int E>
+	typename rt::log2<sf<B, E>>::rt log2(const sf<B, E>& x) {
+		return detail::log2_impl<typename rt::log2<sf<B, E>>::rt, E>(x.num);
+	}
+
+	template<uint B, int E>
+	typename rt::log<usf<B, E>>::rt log(const usf<B, E>& x) {
+		return detail::log_impl<typename rt::log<usf<B, E>>::rt, E>(x.num);
+	}
+
+	template<uint B, int E>
+	typename rt::log<sf<B, E>>::rt log(const sf<B, E>& x) {
+		return detail::log_impl<typename rt::log<sf<B, E>>::rt, E>(x.num);
+	}
+
+	/**
+	 * Exponentials from integer part of argument as shift,
+	 * and fraction part from table with quadratic polynomial.
+	 * Error is at most epsilon of result type.
+	 */
+	template<uint B, int E>
+	typename rt::exp2<sf<B, E>>::rt exp2(const sf<B, E>& x) {
+		return detail::exp2_impl<typename rt::exp2<sf<B, E>>::rt, E>(x.num);
+	}
+
+	template<uint B, int E>
+	typename rt::exp2<usf<B, E>>::rt exp2(const usf<B, E>& x) {
+		return detail::exp2_impl<typename rt::exp2<usf<B, E>>::rt, E>(x.num);
+	}
+
+	template<uint B, int E>
+	typename rt::exp<sf<B, E>>::rt exp(const sf<B, E>& x) {
+		return detail::exp_impl<typename rt::exp<sf<B, E>>::rt, E>(x.num);
+	}
+
+	template<uint B, int E>
+	typename rt::exp<usf<B, E>>::rt exp(const usf<B, E>& x) {
+		return detail::exp_impl<typename rt::exp<usf<B, E>>::rt, E>(x.num);
+	}
+
+	////////////////////////////////////
+
+	/**
+	 * Batch versions, out[i] = f(in[i]).
+	 * Arrays never alias and kernels are without branches,
+	 * so loops are vectorized with gathers from tables.
+	 * log2() and log() need vector leading zero count (AVX-512CD).
+	 */
+	template<uint B, int E>
+	void log2(
+		const usf<B, E>* __restrict in,
+		typename rt::log2<usf<B, E>>::rt* __restrict out,
+		size_t n
+	) {
+		for(size_t i = 0; i < n; i++){
+			out[i] = log2(in[i]);
+		}
+	}
+
+	template<uint B, int E>
+	void log(
+		const usf<B, E>* __restrict in,
+		typename rt::log<usf<B, E>>::rt* __restrict out,
+		size_t n
+	) {
+		for(size_t i = 0; i < n; i++){
+			out[i] = log(in[i]);
+		}
+	}
+
+	template<uint B, int E>
+	void exp2(
+		const sf<B, E>* __restrict in,
+		typename rt::exp2<sf<B, E>>::rt* __restrict out,
+		size_t n
+	) {
+		for(size_t i = 0; i < n; i++){
+			out[i] = exp2(in[i]);
+		}
+	}
+
+	template<uint B, int E>
+	void exp(
+		const sf<B, E>* __restrict in,
+		typename rt::exp<sf<B, E>>::rt* __restrict out,
+		size_t n
+	) {
+		for(size_t i = 0; i < n; i++){
+			out[i] = exp(in[i]);
+		}
+	}
+
+	////////////////////////////////////
+
+} // namespace static_float
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // STATIC_FLOAT_EXP_LOG_H_
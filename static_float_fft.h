@@ -0,0 +1,273 @@
+/**
+ * @file static_float_fft.h
+ * @date Oct 19, 2026
+ *
+ * @author Milos Subotic <milos.subotic.sm@gmail.com>
+ * @license MIT
+ *
+ * @brief Radix-2 Stockham FFT with scaling of every stage in types.
+ *
+ * @version 1.0
+ * Changelog:
+ * 1.0 - Initial version.
+ *
+ */
+
+#ifndef STATIC_FLOAT_FFT_H_
+#define STATIC_FLOAT_FFT_H_
+
+///////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+#include <cmath>
+#include <type_traits>
+
+#include "static_float.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+namespace static_float {
+
+	/**
+	 * Scaling of FFT stage.
+	 * Radix-2 butterfly grows magnitude of complex number at most twice.
+	 */
+	enum fft_scale {
+		/// One bit more for every stage.
+		fft_grow,
+		/// Result is halved with rounding, exponent is incremented.
+		fft_halve,
+		/// Same type, result is saturated.
+		fft_saturate
+	};
+
+	/**
+	 * Policy with same scaling for all stages.
+	 * Custom policies need only static constexpr scale(stage).
+	 */
+	template<fft_scale F>
+	struct fft_policy {
+		static constexpr fft_scale scale(uint) {
+			return F;
+		}
+	};
+
+	/**
+	 * Grow for first G stages, and halve for all others.
+	 */
+	template<uint G>
+	struct fft_policy_grow_then_halve {
+		static constexpr fft_scale scale(uint stage) {
+			return stage < G ? fft_grow : fft_halve;
+		}
+	};
+
+	namespace detail {
+
+		/**
+		 * Type of data after S stages.
+		 * All stages saturate to range of their type,
+		 * so rounding of twiddles and products never wraps around.
+		 */
+		template<typename T, typename P, uint S>
+		struct fft_stage_type {
+			typedef typename fft_stage_type<T, P, S - 1>::type prev;
+			static constexpr fft_scale scale = P::scale(S - 1);
+			typedef sf<
+				prev::b + (scale == fft_grow ? 1 : 0),
+				prev::e + (scale == fft_halve ? 1 : 0)
+			> type;
+		};
+
+		template<typename T, typename P>
+		struct fft_stage_type<T, P, 0> {
+			typedef T type;
+		};
+
+	} // namespace detail
+
+	////////////////////////////////////
+
+	/**
+	 * @class fft
+	 * @brief Forward or inverse FFT of N complex numbers.
+	 * Data are in separate arrays of real and imaginary parts.
+	 * Stockham autosort schedule ping-pongs between two buffers,
+	 * so there is no bit reversal and every stage is sequential
+	 * in memory. Loops of butterflies are vectorized.
+	 * Output is approximation of unnormalized DFT,
+	 * X[k] = sum of x[n]*exp(-+2*pi*i*k*n/N).
+	 * @param N size, power of 2
+	 * @param T input type
+	 * @param P scaling policy
+	 * @param TW twiddle type
+	 * @param R rounding of butterflies
+	 */
+	template<
+		uint N,
+		typename T,
+		typename P = fft_policy<fft_grow>,
+		typename TW = sf<15, -14>,
+		round_mode R = round_nearest
+	>
+	class fft {
+		static_assert(N >= 2 && (N & (N - 1)) == 0, "N must be power of 2!");
+		static_assert(
+			detail::is_signed_type((T*)nullptr)
+				&& detail::is_signed_type((TW*)nullptr),
+			"FFT is only for signed static floats!"
+		);
+		static_assert(
+			TW::e < 0 && int(TW::b) + TW::e >= 1,
+			"Twiddles must have fraction bits and represent 1!"
+		);
+
+	public:
+		static constexpr uint stages = detail::ceil_log2(N);
+
+		typedef typename detail::fft_stage_type<T, P, stages>::type out_type;
+
+		static_assert(out_type::b < 64, "Data are wider than 64 bits!");
+
+		////////////////////////////
+
+	private:
+		/// All stages in place, bits are never decreased.
+		typedef typename out_type::num_type st;
+		typedef typename TW::num_type wt;
+		/// Sum of two products of data difference, which have one bit more,
+		/// and twiddle.
+		typedef typename sf<out_type::b + TW::b + 2, 0>::num_type pt;
+
+		std::vector<wt> wr;
+		std::vector<wt> wi;
+		std::vector<st> buf[4];
+
+		////////////////////////////
+
+	public:
+		explicit fft(bool inverse = false)
+			: wr(N/2), wi(N/2) {
+			const double two_pi = 6.283185307179586476925286766559;
+			const double sign = inverse ? 1 : -1;
+			for(uint k = 0; k < N/2; k++){
+				double a = two_pi*k/N;
+				// Rounded to nearest.
+				wr[k] = wt(std::llround(std::ldexp(std::cos(a), -TW::e)));
+				wi[k] = wt(std::llround(std::ldexp(sign*std::sin(a), -TW::e)));
+			}
+			for(uint i = 0; i < 4; i++){
+				buf[i].resize(N);
+			}
+		}
+
+		////////////////////////////
+
+		void operator()(
+			const T* in_re,
+			const T* in_im,
+			out_type* out_re,
+			out_type* out_im
+		) {
+			for(uint i = 0; i < N; i++){
+				buf[0][i] = in_re[i].num;
+				buf[1][i] = in_im[i].num;
+			}
+			run_stages(std::integral_constant<uint, 0>());
+			// Even number of stages ends in first pair of buffers.
+			const uint o = stages % 2 ? 2 : 0;
+			for(uint i = 0; i < N; i++){
+				out_re[i].num = buf[o][i];
+				out_im[i].num = buf[o + 1][i];
+			}
+		}
+
+		////////////////////////////
+
+	private:
+		void run_stages(std::integral_constant<uint, stages>) {
+		}
+
+		template<uint S>
+		void run_stages(std::integral_constant<uint, S>) {
+			const uint i = S % 2 ? 2 : 0;
+			const uint o = S % 2 ? 0 : 2;
+			stage<S>(
+				buf[i].data(), buf[i + 1].data(),
+				buf[o].data(), buf[o + 1].data(),
+				wr.data(), wi.data()
+			);
+			run_stages(std::integral_constant<uint, S + 1>());
+		}
+
+		/**
+		 * Stage S of decimation in frequency:
+		 * y[q + s*2p] = a + b, y[q + s*(2p + 1)] = (a - b)*w^(p*s),
+		 * with a = x[q + s*p], b = x[q + s*(p + m)], s = 2^S, m = N/2/s.
+		 */
+		template<uint S>
+		static void stage(
+			const st* __restrict xr,
+			const st* __restrict xi,
+			st* __restrict yr,
+			st* __restrict yi,
+			const wt* __restrict twr,
+			const wt* __restrict twi
+		) {
+			typedef typename detail::fft_stage_type<T, P, S + 1>::type yt;
+			constexpr bool halve = P::scale(S) == fft_halve;
+			constexpr uint SH = uint(-TW::e) + (halve ? 1 : 0);
+			const pt max = (pt(1) << yt::b) - 1;
+			const pt min = -(pt(1) << yt::b);
+
+			const uint s = 1u << S;
+			const uint m = N/2 >> S;
+
+			auto butterfly = [&](uint q, uint p) {
+				const uint i0 = q + s*p;
+				const uint i1 = i0 + s*m;
+				const uint o0 = q + s*2*p;
+				const uint o1 = o0 + s;
+				const pt w_r = twr[p*s];
+				const pt w_i = twi[p*s];
+				pt sr = pt(xr[i0]) + pt(xr[i1]);
+				pt si = pt(xi[i0]) + pt(xi[i1]);
+				pt dr = pt(xr[i0]) - pt(xr[i1]);
+				pt di = pt(xi[i0]) - pt(xi[i1]);
+				if(halve){
+					sr = detail::round_shift<R, 1>(sr);
+					si = detail::round_shift<R, 1>(si);
+				}
+				pt pr = detail::round_shift<R, SH>(pt(dr*w_r - di*w_i));
+				pt pi = detail::round_shift<R, SH>(pt(dr*w_i + di*w_r));
+				yr[o0] = st(sr > max ? max : sr < min ? min : sr);
+				yi[o0] = st(si > max ? max : si < min ? min : si);
+				yr[o1] = st(pr > max ? max : pr < min ? min : pr);
+				yi[o1] = st(pi > max ? max : pi < min ? min : pi);
+			};
+
+			if(s >= 8){
+				for(uint p = 0; p < m; p++){
+					for(uint q = 0; q < s; q++){
+						butterfly(q, p);
+					}
+				}
+			}else{
+				for(uint q = 0; q < s; q++){
+					for(uint p = 0; p < m; p++){
+						butterfly(q, p);
+					}
+				}
+			}
+		}
+
+		////////////////////////////
+	};
+
+	////////////////////////////////////
+
+} // namespace static_float
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // STATIC_FLOAT_FFT_H_
@@ -0,0 +1,700 @@
+/**
+ * @file static_float_file.h
+ * @date Oct 19, 2026
+ *
+ * @author Milos Subotic <milos.subotic.sm@gmail.com>
+ * @license MIT
+ *
+ * @brief Self-describing binary files of static float arrays,
+ * read with mmap as sf_span views.
+ *
+ * Layout of file, header fields are little endian:
+ *  0 char[8] magic "SFARRAY1"
+ *  8 uint32 version
+ * 12 uint32 header size, 64
+ * 16 uint64 count of elements
+ * 24 int32  exponent E
+ * 28 uint16 bits B, without sign
+ * 30 uint8  1 for sf, 0 for usf
+ * 31 uint8  byte order of elements, 0 little, 1 big
+ * 32 uint8  bytes of element, sizeof num_type, or 0 for packed
+ * 33 uint8  packing, 0 raw elements, 1 packed bits
+ * 34 uint16 bits of packed element, B with sign
+ * 36 uint32 reserved
+ * 40 uint64 offset of data, 64
+ * 48 reserved to 64
+ * Packed elements are bit stream of B + sign bits per element,
+ * first element in least significant bits of first byte.
+ *
+ * @version 1.0
+ * Changelog:
+ * 1.0 - Initial version.
+ *
+ */
+
+#ifndef STATIC_FLOAT_FILE_H_
+#define STATIC_FLOAT_FILE_H_
+
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <type_traits>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "static_float.h"
+#include "static_float_span.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+namespace static_float {
+
+	/**
+	 * How elements are stored.
+	 */
+	enum sf_file_packing {
+		/// Elements as num_type, which could be viewed without copy.
+		sf_file_raw,
+		/// Only B + sign bits per element, read by conversion.
+		sf_file_bits
+	};
+
+	/**
+	 * Byte order of raw elements.
+	 */
+	enum sf_file_order {
+		sf_file_little,
+		sf_file_big,
+		sf_file_native = __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+			? sf_file_little
+			: sf_file_big
+	};
+
+	namespace detail {
+
+		constexpr uint sf_file_version = 1;
+		constexpr uint sf_file_header_size = 64;
+		/// Zeros after packed data, so last element is read with 8 bytes.
+		constexpr uint sf_file_pad = 16;
+
+		inline void put_le(uint8_t* p, uint64_t v, uint bytes) {
+			for(uint i = 0; i < bytes; i++){
+				p[i] = uint8_t(v >> (8*i));
+			}
+		}
+
+		inline uint64_t get_le(const uint8_t* p, uint bytes) {
+			uint64_t v = 0;
+			for(uint i = 0; i < bytes; i++){
+				v |= uint64_t(p[i]) << (8*i);
+			}
+			return v;
+		}
+
+		inline uint8_t byte_swap(uint8_t v) {
+			return v;
+		}
+
+		inline uint16_t byte_swap(uint16_t v) {
+			return __builtin_bswap16(v);
+		}
+
+		inline uint32_t byte_swap(uint32_t v) {
+			return __builtin_bswap32(v);
+		}
+
+		inline uint64_t byte_swap(uint64_t v) {
+			return __builtin_bswap64(v);
+		}
+
+		/**
+		 * Fields of header.
+		 */
+		struct sf_file_header {
+			uint64_t count;
+			int e;
+			uint b;
+			bool is_signed;
+			sf_file_order order;
+			uint elem_bytes;
+			sf_file_packing packing;
+			uint bits;
+			uint64_t data_offset;
+
+			void encode(uint8_t* p) const {
+				memset(p, 0, sf_file_header_size);
+				memcpy(p, "SFARRAY1", 8);
+				put_le(p + 8, sf_file_version, 4);
+				put_le(p + 12, sf_file_header_size, 4);
+				put_le(p + 16, count, 8);
+				put_le(p + 24, uint32_t(e), 4);
+				put_le(p + 28, b, 2);
+				p[30] = is_signed;
+				p[31] = uint8_t(order);
+				p[32] = uint8_t(elem_bytes);
+				p[33] = uint8_t(packing);
+				put_le(p + 34, bits, 2);
+				put_le(p + 40, data_offset, 8);
+			}
+
+			/**
+			 * @return false if p is not valid header
+			 */
+			bool decode(const uint8_t* p) {
+				count = get_le(p + 16, 8);
+				e = int(int32_t(get_le(p + 24, 4)));
+				b = uint(get_le(p + 28, 2));
+				is_signed = p[30] != 0;
+				order = sf_file_order(p[31]);
+				elem_bytes = p[32];
+				packing = sf_file_packing(p[33]);
+				bits = uint(get_le(p + 34, 2));
+				data_offset = get_le(p + 40, 8);
+				return memcmp(p, "SFARRAY1", 8) == 0
+					&& get_le(p + 8, 4) == sf_file_version
+					&& get_le(p + 12, 4) == sf_file_header_size
+					&& p[31] <= 1 && p[33] <= 1
+					&& bits == b + is_signed && bits >= 1 && bits <= 64
+					&& (packing == sf_file_bits
+						? elem_bytes == 0
+						: elem_bytes*8 >= bits
+							&& (elem_bytes & (elem_bytes - 1)) == 0
+							&& elem_bytes <= 8)
+					&& data_offset >= sf_file_header_size;
+			}
+
+			uint64_t data_bytes() const {
+				return packing == sf_file_bits
+					? (count*bits + 7)/8 + sf_file_pad
+					: count*elem_bytes;
+			}
+
+			/**
+			 * @return true if data fits into avail bytes.
+			 * Count is untrusted, so it is checked before multiplication.
+			 */
+			bool data_fits(uint64_t avail) const {
+				if(packing != sf_file_bits){
+					return count <= avail/elem_bytes;
+				}
+				return count <= (~uint64_t(0) - 7)/bits
+					&& data_bytes() <= avail;
+			}
+		};
+
+		/**
+		 * v in units of 2^-SH of T, rounded to nearest and saturated.
+		 */
+		template<typename T>
+		typename T::num_type sf_file_rescale(int64_t v, int sh) {
+			constexpr bool t_signed = is_signed_type((T*)nullptr);
+			constexpr int64_t max = int64_t((uint64_t(1) << T::b) - 1);
+			constexpr int64_t min = t_signed ? -max - 1 : 0;
+			if(sh > 0){
+				// Rounding bit is added after shift, so it can't overflow.
+				v = sh < 64 ? (v >> sh) + ((v >> (sh - 1)) & 1) : 0;
+			}else if(sh < 0){
+				const int ls = -sh;
+				v = ls > 62 || v > (max >> ls) ? v > 0 ? max : v < 0 ? min : 0
+					: v < (min >> ls) ? min : int64_t(uint64_t(v) << ls);
+			}
+			v = v > max ? max : v < min ? min : v;
+			return typename T::num_type(v);
+		}
+
+		/**
+		 * Unsigned v, which could be above 2^63.
+		 */
+		template<typename T>
+		typename T::num_type sf_file_rescale(uint64_t v, int sh) {
+			constexpr uint64_t max = (uint64_t(1) << T::b) - 1;
+			if(sh > 0){
+				// Rounding bit is added after shift, so it can't overflow.
+				v = sh < 64 ? (v >> sh) + ((v >> (sh - 1)) & 1) : 0;
+			}else if(sh < 0){
+				const int ls = -sh;
+				v = ls > 62 ? (v ? max : 0) : v > (max >> ls) ? max : v << ls;
+			}
+			return typename T::num_type(v > max ? max : v);
+		}
+
+		/**
+		 * Convert raw elements S, with bytes swapped if needed.
+		 */
+		template<typename S, typename T>
+		void sf_file_convert_raw(
+			const uint8_t* __restrict data,
+			T* __restrict out,
+			size_t n,
+			bool swap,
+			int sh
+		) {
+			typedef typename std::make_unsigned<S>::type U;
+			/// Unsigned elements are rescaled unsigned, for usf<64>.
+			typedef typename std::conditional<
+				std::is_signed<S>::value,
+				int64_t,
+				uint64_t
+			>::type W;
+			// Offset of data could be unaligned for S.
+			for(size_t i = 0; i < n; i++){
+				S v;
+				memcpy(&v, data + i*sizeof(S), sizeof(S));
+				if(swap){
+					v = S(byte_swap(U(v)));
+				}
+				out[i].num = sf_file_rescale<T>(W(v), sh);
+			}
+		}
+
+		/**
+		 * Convert packed elements of bits, up to 56 bits,
+		 * so that element is within 8 bytes read from its first byte.
+		 */
+		template<bool Signed, bool Rescale, typename T>
+		void sf_file_convert_bits(
+			const uint8_t* __restrict data,
+			T* __restrict out,
+			size_t n,
+			uint bits,
+			int sh
+		) {
+			typedef typename std::conditional<Signed, int64_t, uint64_t>::type W;
+			for(size_t i = 0; i < n; i++){
+				const uint64_t pos = uint64_t(i)*bits;
+				uint64_t w;
+				memcpy(&w, data + pos/8, 8);
+				// Bytes are little endian in stream.
+				if(sf_file_native == sf_file_big){
+					w = byte_swap(w);
+				}
+				// Element to top bits, and back with sign extension.
+				const int64_t x = int64_t(
+					W(w << (64 - pos % 8 - bits)) >> (64 - bits)
+				);
+				out[i].num = Rescale
+					? sf_file_rescale<T>(x, sh)
+					: typename T::num_type(x);
+			}
+		}
+
+		/**
+		 * Convert packed elements of more than 56 bits.
+		 */
+		template<typename T>
+		void sf_file_convert_wide_bits(
+			const uint8_t* __restrict data,
+			T* __restrict out,
+			size_t n,
+			uint bits,
+			bool is_signed,
+			int sh
+		) {
+			const uint64_t mask = bits == 64 ? ~uint64_t(0) : (uint64_t(1) << bits) - 1;
+			for(size_t i = 0; i < n; i++){
+				const uint64_t pos = uint64_t(i)*bits;
+				const uint8_t* p = data + pos/8;
+				const uint s = uint(pos % 8);
+				uint64_t v = get_le(p, 8) >> s;
+				if(s + bits > 64){
+					v |= uint64_t(p[8]) << (64 - s);
+				}
+				v &= mask;
+				if(is_signed){
+					int64_t x = int64_t(v);
+					if(bits < 64 && (v >> (bits - 1))){
+						x = int64_t(v | ~mask);
+					}
+					out[i].num = sf_file_rescale<T>(x, sh);
+				}else{
+					out[i].num = sf_file_rescale<T>(v, sh);
+				}
+			}
+		}
+
+	} // namespace detail
+
+	////////////////////////////////////
+
+	/**
+	 * @class sf_file_writer
+	 * @brief Writer of file of elements T, in one or more writes.
+	 * Count in header is written at close().
+	 * @param T static float type
+	 */
+	template<typename T>
+	class sf_file_writer {
+	public:
+		typedef typename T::num_type num_type;
+
+		static_assert(
+			std::is_integral<num_type>::value && sizeof(num_type) <= 8,
+			"Only static floats up to 64 bits could be written!"
+		);
+
+		////////////////////////////
+
+	private:
+		FILE* f;
+		detail::sf_file_header h;
+		std::string path;
+		/// Bits of packed elements not written yet.
+		uint64_t acc;
+		uint acc_bits;
+		std::vector<uint8_t> buf;
+
+		////////////////////////////
+
+	public:
+		explicit sf_file_writer(
+			const std::string& path,
+			sf_file_packing packing = sf_file_raw,
+			sf_file_order order = sf_file_native
+		)
+			: f(fopen(path.c_str(), "wb")), path(path), acc(0), acc_bits(0) {
+			if(!f){
+				throw exceptions::io_error()
+					<< "Cannot create " << path << exceptions::endl;
+			}
+			h.count = 0;
+			h.e = T::e;
+			h.b = T::b;
+			h.is_signed = detail::is_signed_type((T*)nullptr);
+			h.order = packing == sf_file_raw ? order : sf_file_little;
+			h.packing = packing;
+			h.elem_bytes = packing == sf_file_raw ? sizeof(num_type) : 0;
+			h.bits = h.b + h.is_signed;
+			h.data_offset = detail::sf_file_header_size;
+			write_header();
+		}
+
+		~sf_file_writer() {
+			if(f){
+				try{
+					close();
+				}catch(...){
+				}
+			}
+		}
+
+		sf_file_writer(const sf_file_writer&) = delete;
+		sf_file_writer& operator=(const sf_file_writer&) = delete;
+
+		////////////////////////////
+
+	public:
+		void write(const T* x, size_t n) {
+			if(h.packing == sf_file_bits){
+				write_bits(x, n);
+			}else if(h.order == sf_file_native){
+				put(x, sizeof(T)*n);
+			}else{
+				typedef typename std::make_unsigned<num_type>::type U;
+				const size_t block = 4096;
+				U tmp[block];
+				for(size_t i = 0; i < n; i += block){
+					const size_t m = n - i < block ? n - i : block;
+					for(size_t j = 0; j < m; j++){
+						tmp[j] = detail::byte_swap(U(x[i + j].num));
+					}
+					put(tmp, sizeof(U)*m);
+				}
+			}
+			h.count += n;
+		}
+
+		/**
+		 * Flush data and write header with count.
+		 */
+		void close() {
+			if(h.packing == sf_file_bits){
+				while(acc_bits > 0){
+					buf.push_back(uint8_t(acc));
+					acc >>= 8;
+					acc_bits = acc_bits > 8 ? acc_bits - 8 : 0;
+				}
+				buf.resize(buf.size() + detail::sf_file_pad, 0);
+				flush_buf();
+			}
+			write_header();
+			const bool ok = fclose(f) == 0;
+			f = nullptr;
+			if(!ok){
+				throw exceptions::io_error()
+					<< "Cannot write " << path << exceptions::endl;
+			}
+		}
+
+		////////////////////////////
+
+	private:
+		void put(const void* p, size_t bytes) {
+			if(fwrite(p, 1, bytes, f) != bytes){
+				throw exceptions::io_error()
+					<< "Cannot write " << path << exceptions::endl;
+			}
+		}
+
+		void write_header() {
+			uint8_t p[detail::sf_file_header_size];
+			h.encode(p);
+			if(fseek(f, 0, SEEK_SET) != 0){
+				throw exceptions::io_error()
+					<< "Cannot seek " << path << exceptions::endl;
+			}
+			put(p, sizeof(p));
+			fseek(f, 0, SEEK_END);
+		}
+
+		void flush_buf() {
+			put(buf.data(), buf.size());
+			buf.clear();
+		}
+
+		void write_bits(const T* x, size_t n) {
+			const uint bits = h.bits;
+			const uint64_t mask = bits == 64
+				? ~uint64_t(0)
+				: (uint64_t(1) << bits) - 1;
+			for(size_t i = 0; i < n; i++){
+				const uint64_t v = uint64_t(int64_t(x[i].num)) & mask;
+				acc |= v << acc_bits;
+				const uint total = acc_bits + bits;
+				if(total >= 64){
+					for(uint j = 0; j < 8; j++){
+						buf.push_back(uint8_t(acc >> (8*j)));
+					}
+					// Bits of v which didn't fit.
+					acc = acc_bits ? v >> (64 - acc_bits) : 0;
+					acc_bits = total - 64;
+				}else{
+					acc_bits = total;
+				}
+				if(buf.size() >= 1 << 16){
+					flush_buf();
+				}
+			}
+		}
+	};
+
+	/**
+	 * Write n elements x to file at path.
+	 */
+	template<typename T>
+	void write_sf_file(
+		const std::string& path,
+		const T* x,
+		size_t n,
+		sf_file_packing packing = sf_file_raw
+	) {
+		sf_file_writer<T> w(path, packing);
+		w.write(x, n);
+		w.close();
+	}
+
+	////////////////////////////////////
+
+	/**
+	 * @class sf_file
+	 * @brief File of static floats mapped to memory.
+	 * Raw file of same type is viewed without copy,
+	 * and any file is converted to any type with rounding to nearest.
+	 */
+	class sf_file {
+	private:
+		int fd;
+		const uint8_t* map;
+		size_t map_size;
+		detail::sf_file_header h;
+
+		////////////////////////////
+
+	public:
+		explicit sf_file(const std::string& path)
+			: fd(-1), map(nullptr), map_size(0) {
+			fd = ::open(path.c_str(), O_RDONLY);
+			struct stat st;
+			if(fd < 0 || fstat(fd, &st) != 0){
+				release();
+				throw exceptions::io_error()
+					<< "Cannot open " << path << exceptions::endl;
+			}
+			map_size = size_t(st.st_size);
+			if(map_size >= detail::sf_file_header_size){
+				void* m = mmap(nullptr, map_size, PROT_READ, MAP_SHARED, fd, 0);
+				map = m == MAP_FAILED ? nullptr : static_cast<const uint8_t*>(m);
+			}
+			if(!map){
+				release();
+				throw exceptions::io_error()
+					<< "Cannot map " << path << exceptions::endl;
+			}
+			if(!h.decode(map)
+					|| h.data_offset > map_size
+					|| !h.data_fits(map_size - h.data_offset)){
+				release();
+				throw exceptions::format_error()
+					<< path << " is not valid static float file"
+					<< exceptions::endl;
+			}
+		}
+
+		~sf_file() {
+			release();
+		}
+
+		sf_file(const sf_file&) = delete;
+		sf_file& operator=(const sf_file&) = delete;
+
+		////////////////////////////
+
+	public:
+		size_t size() const {
+			return size_t(h.count);
+		}
+
+		uint b() const {
+			return h.b;
+		}
+
+		int e() const {
+			return h.e;
+		}
+
+		bool is_signed() const {
+			return h.is_signed;
+		}
+
+		sf_file_packing packing() const {
+			return h.packing;
+		}
+
+		sf_file_order order() const {
+			return h.order;
+		}
+
+		/**
+		 * True if data is array of T, which is viewed without copy.
+		 * Map is page aligned, so data must be at offset aligned for T.
+		 */
+		template<typename T>
+		bool is_view_of() const {
+			typedef typename std::remove_const<T>::type V;
+			return h.packing == sf_file_raw
+				&& h.order == sf_file_native
+				&& h.b == V::b
+				&& h.e == V::e
+				&& h.is_signed == detail::is_signed_type((V*)nullptr)
+				&& h.elem_bytes == sizeof(typename V::num_type)
+				&& h.data_offset % alignof(V) == 0;
+		}
+
+		/**
+		 * View of data as array of T, without copy.
+		 * View is valid while file is open.
+		 * Throws format_error if !is_view_of<T>().
+		 */
+		template<typename T>
+		basic_sf_span<const T> view() const {
+			if(!is_view_of<T>()){
+				throw exceptions::format_error()
+					<< "Data is not of requested type" << exceptions::endl;
+			}
+			return basic_sf_span<const T>(
+				reinterpret_cast<const T*>(map + h.data_offset),
+				size()
+			);
+		}
+
+		/**
+		 * Convert all elements to T, rounded to nearest and saturated.
+		 * @param out array of size() elements
+		 */
+		template<typename T>
+		void convert(T* out) const {
+			static_assert(T::b <= 62, "Conversion is up to 62 bits!");
+			const uint8_t* d = map + h.data_offset;
+			const int sh = T::e - h.e;
+			const size_t n = size();
+			if(h.packing == sf_file_bits){
+				const uint bits = h.bits;
+				// Same num is only moved to num_type of T.
+				const bool same = sh == 0 && h.b <= T::b
+					&& h.is_signed == detail::is_signed_type((T*)nullptr);
+				if(bits > 56){
+					detail::sf_file_convert_wide_bits(d, out, n, bits, h.is_signed, sh);
+				}else if(h.is_signed){
+					same
+						? detail::sf_file_convert_bits<true, false>(d, out, n, bits, sh)
+						: detail::sf_file_convert_bits<true, true>(d, out, n, bits, sh);
+				}else{
+					same
+						? detail::sf_file_convert_bits<false, false>(d, out, n, bits, sh)
+						: detail::sf_file_convert_bits<false, true>(d, out, n, bits, sh);
+				}
+				return;
+			}
+			const bool swap = h.order != sf_file_native;
+			switch(h.elem_bytes*2 + h.is_signed){
+			case 2:
+				detail::sf_file_convert_raw<uint8_t>(d, out, n, swap, sh);
+				break;
+			case 3:
+				detail::sf_file_convert_raw<int8_t>(d, out, n, swap, sh);
+				break;
+			case 4:
+				detail::sf_file_convert_raw<uint16_t>(d, out, n, swap, sh);
+				break;
+			case 5:
+				detail::sf_file_convert_raw<int16_t>(d, out, n, swap, sh);
+				break;
+			case 8:
+				detail::sf_file_convert_raw<uint32_t>(d, out, n, swap, sh);
+				break;
+			case 9:
+				detail::sf_file_convert_raw<int32_t>(d, out, n, swap, sh);
+				break;
+			case 16:
+				detail::sf_file_convert_raw<uint64_t>(d, out, n, swap, sh);
+				break;
+			case 17:
+				detail::sf_file_convert_raw<int64_t>(d, out, n, swap, sh);
+				break;
+			}
+		}
+
+		template<typename T>
+		std::vector<T> load() const {
+			std::vector<T> v(size());
+			convert(v.data());
+			return v;
+		}
+
+		////////////////////////////
+
+	private:
+		void release() {
+			if(map){
+				munmap(const_cast<uint8_t*>(map), map_size);
+				map = nullptr;
+			}
+			if(fd >= 0){
+				::close(fd);
+				fd = -1;
+			}
+		}
+	};
+
+	////////////////////////////////////
+
+} // namespace static_float
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // STATIC_FLOAT_FILE_H_
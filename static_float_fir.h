@@ -0,0 +1,488 @@
+/**
+ * @file static_float_fir.h
+ * @date Oct 19, 2026
+ *
+ * @author Milos Subotic <milos.subotic.sm@gmail.com>
+ * @license MIT
+ *
+ * @brief Streaming FIR filters with polyphase decimation and interpolation.
+ *
+ * @version 1.0
+ * Changelog:
+ * 1.0 - Initial version.
+ *
+ */
+
+#ifndef STATIC_FLOAT_FIR_H_
+#define STATIC_FLOAT_FIR_H_
+
+///////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+#include <algorithm>
+#include <type_traits>
+#include <cassert>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+#include "static_float.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Number of outputs computed at once by FIR kernel.
+ * Accumulators of block are kept in local array, so loop over outputs
+ * for one tap is vectorized.
+ */
+#ifndef STATIC_FLOAT_FIR_BLOCK
+#define STATIC_FLOAT_FIR_BLOCK 256
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+
+namespace static_float {
+
+	namespace detail {
+
+		/**
+		 * acc[i] = sum over k < taps of r[k]*x[i + k], i < n.
+		 * r are coefficients in reversed order.
+		 * Products of G taps are summed in narrow PT,
+		 * and only then widened to CT.
+		 */
+		template<typename CT, typename PT, uint G, typename CN, typename XN>
+		void fir_kernel(
+			const CN* r,
+			uint taps,
+			const XN* x,
+			size_t n,
+			CT* acc
+		) {
+			CT a[STATIC_FLOAT_FIR_BLOCK];
+			PT p[STATIC_FLOAT_FIR_BLOCK];
+			for(size_t i0 = 0; i0 < n; i0 += STATIC_FLOAT_FIR_BLOCK){
+				const size_t bn = std::min<size_t>(
+					n - i0,
+					STATIC_FLOAT_FIR_BLOCK
+				);
+				for(size_t i = 0; i < bn; i++){
+					a[i] = 0;
+				}
+				for(uint k0 = 0; k0 < taps; k0 += G){
+					const uint k1 = std::min(taps, k0 + G);
+					for(size_t i = 0; i < bn; i++){
+						p[i] = 0;
+					}
+					for(uint k = k0; k < k1; k++){
+						const CN rk = r[k];
+						const XN* xk = x + i0 + k;
+						for(size_t i = 0; i < bn; i++){
+							p[i] += PT(rk) * PT(xk[i]);
+						}
+					}
+					for(size_t i = 0; i < bn; i++){
+						a[i] += CT(p[i]);
+					}
+				}
+				std::copy(a, a + bn, acc + i0);
+			}
+		}
+
+#ifdef __AVX2__
+		/**
+		 * Kernel for int16 coefficients and samples with int64 accumulator.
+		 * Pairs of taps are multiplied and summed with _mm256_madd_epi16,
+		 * samples are interleaved with themselves shifted by one,
+		 * so 16 outputs are computed per iteration.
+		 * Sum of two products must fit into int32.
+		 */
+		template<uint G>
+		void fir_kernel_madd16(
+			const int16_t* r,
+			uint taps,
+			const int16_t* x,
+			size_t n,
+			int64_t* acc
+		) {
+			static_assert(G >= 2, "Pair of products must fit into int32!");
+			const size_t n16 = taps < 2 ? 0 : n/16*16;
+			for(size_t i = 0; i < n16; i += 16){
+				__m256i a0 = _mm256_setzero_si256();
+				__m256i a1 = _mm256_setzero_si256();
+				__m256i a2 = _mm256_setzero_si256();
+				__m256i a3 = _mm256_setzero_si256();
+				for(uint k0 = 0; k0 < taps; k0 += G){
+					const uint k1 = std::min(taps, k0 + G);
+					// Outputs 0-3 and 8-11 in lo, 4-7 and 12-15 in hi.
+					__m256i lo = _mm256_setzero_si256();
+					__m256i hi = _mm256_setzero_si256();
+					for(uint k = k0; k < k1; k += 2){
+						// Odd last tap is paired with zero before it.
+						uint kk = k + 1 < taps ? k : k - 1;
+						int16_t r0 = k + 1 < taps ? r[k] : int16_t(0);
+						__m256i c = _mm256_set1_epi32(
+							int32_t(uint16_t(r0)) | int32_t(r[kk + 1]) << 16
+						);
+						__m256i v0 = _mm256_loadu_si256(
+							(const __m256i*)(x + i + kk)
+						);
+						__m256i v1 = _mm256_loadu_si256(
+							(const __m256i*)(x + i + kk + 1)
+						);
+						lo = _mm256_add_epi32(
+							lo,
+							_mm256_madd_epi16(_mm256_unpacklo_epi16(v0, v1), c)
+						);
+						hi = _mm256_add_epi32(
+							hi,
+							_mm256_madd_epi16(_mm256_unpackhi_epi16(v0, v1), c)
+						);
+					}
+					a0 = _mm256_add_epi64(a0, _mm256_cvtepi32_epi64(
+						_mm256_castsi256_si128(lo)));
+					a1 = _mm256_add_epi64(a1, _mm256_cvtepi32_epi64(
+						_mm256_castsi256_si128(hi)));
+					a2 = _mm256_add_epi64(a2, _mm256_cvtepi32_epi64(
+						_mm256_extracti128_si256(lo, 1)));
+					a3 = _mm256_add_epi64(a3, _mm256_cvtepi32_epi64(
+						_mm256_extracti128_si256(hi, 1)));
+				}
+				_mm256_storeu_si256((__m256i*)(acc + i), a0);
+				_mm256_storeu_si256((__m256i*)(acc + i + 4), a1);
+				_mm256_storeu_si256((__m256i*)(acc + i + 8), a2);
+				_mm256_storeu_si256((__m256i*)(acc + i + 12), a3);
+			}
+			fir_kernel<int64_t, int32_t, G>(
+				r, taps, x + n16, n - n16, acc + n16
+			);
+		}
+#endif
+
+		/**
+		 * Types used in FIR with coefficients TC, samples TI and N taps.
+		 */
+		template<typename TC, typename TI, uint N>
+		struct fir_types {
+			typedef rt::dot<TC, TI, N> d;
+			/// Exact sum of N products.
+			typedef typename d::rt acc_type;
+			/// Accumulator integer.
+			typedef typename d::ct ct;
+			/// Single product is at most 2^(B1+B2) in absolute value,
+			/// so it needs B1+B2+1 bits and sign.
+			typedef typename sf<TC::b + TI::b + 1, 0>::num_type pt;
+			typedef typename TC::num_type cnum;
+			typedef typename TI::num_type xnum;
+			/// Headroom bits of pt above single product.
+			static constexpr uint guard = TC::b + TI::b < 63
+				? 8*sizeof(pt) - 1 - (TC::b + TI::b)
+				: 1;
+			/// Number of products which could be summed in pt.
+			static constexpr uint group = (1u << (guard < 31 ? guard : 31)) - 1;
+			static_assert(group >= 1, "Product does not fit into pt!");
+
+#ifdef __AVX2__
+			static constexpr bool madd16 =
+				std::is_same<cnum, int16_t>::value
+				&& std::is_same<xnum, int16_t>::value
+				&& std::is_same<ct, int64_t>::value
+				&& std::is_same<pt, int32_t>::value
+				&& group >= 3;
+#else
+			static constexpr bool madd16 = false;
+#endif
+
+			static void kernel(
+				const cnum* r,
+				uint taps,
+				const xnum* x,
+				size_t n,
+				ct* acc
+			) {
+				kernel(r, taps, x, n, acc,
+						std::integral_constant<bool, madd16>());
+			}
+
+		private:
+			static void kernel(
+				const cnum* r,
+				uint taps,
+				const xnum* x,
+				size_t n,
+				ct* acc,
+				std::false_type
+			) {
+				fir_kernel<ct, pt, group>(r, taps, x, n, acc);
+			}
+
+#ifdef __AVX2__
+			static void kernel(
+				const cnum* r,
+				uint taps,
+				const xnum* x,
+				size_t n,
+				ct* acc,
+				std::true_type
+			) {
+				fir_kernel_madd16<group & ~1u>(r, taps, x, n, acc);
+			}
+#endif
+		};
+
+	} // namespace detail
+
+	////////////////////////////////////
+
+	/**
+	 * @class fir
+	 * @brief Streaming FIR filter with N taps.
+	 * y[t] = sum over k < N of c[k]*x[t - k].
+	 * Sum is exact in acc_type and requantized to output type.
+	 * Delay line is kept between calls to process().
+	 * @param N number of taps
+	 * @param TC coefficient type
+	 * @param TI sample type
+	 */
+	template<uint N, typename TC, typename TI>
+	class fir {
+		static_assert(N > 0, "FIR must have at least one tap!");
+
+		typedef detail::fir_types<TC, TI, N> types;
+		typedef typename types::ct ct;
+		typedef typename types::cnum cnum;
+		typedef typename types::xnum xnum;
+
+	public:
+		typedef typename types::acc_type acc_type;
+
+		////////////////////////////
+
+	private:
+		/// Coefficients in reversed order.
+		cnum r[N];
+		/// N - 1 samples of history followed by current block.
+		std::vector<xnum> buf;
+		std::vector<ct> acc;
+
+		////////////////////////////
+
+	public:
+		explicit fir(const TC* c)
+			: buf(N - 1, xnum(0)) {
+			for(uint k = 0; k < N; k++){
+				r[k] = c[N - 1 - k].num;
+			}
+		}
+
+		void reset() {
+			buf.assign(N - 1, xnum(0));
+		}
+
+		////////////////////////////
+
+		/**
+		 * Filter n samples from in to out.
+		 */
+		template<typename TO, round_mode R = round_nearest>
+		void process(const TI* in, TO* out, size_t n) {
+			buf.resize(N - 1 + n);
+			for(size_t i = 0; i < n; i++){
+				buf[N - 1 + i] = in[i].num;
+			}
+			acc.resize(n);
+			types::kernel(r, N, buf.data(), n, acc.data());
+
+			acc_type a;
+			for(size_t i = 0; i < n; i++){
+				a.num = acc[i];
+				out[i] = requantize<TO, R>(a);
+			}
+
+			std::copy(buf.end() - (N - 1), buf.end(), buf.begin());
+			buf.resize(N - 1);
+		}
+
+		////////////////////////////
+	};
+
+	/**
+	 * @class fir_decimator
+	 * @brief FIR filter of N taps followed by keeping every M-th output.
+	 * Filter is split to M polyphase subfilters c[q*M + p] which run
+	 * on deinterleaved input phases, so only kept outputs are computed.
+	 */
+	template<uint N, uint M, typename TC, typename TI>
+	class fir_decimator {
+		static_assert(N > 0 && M > 0, "FIR must have at least one tap!");
+
+		typedef detail::fir_types<TC, TI, N> types;
+		typedef typename types::ct ct;
+		typedef typename types::cnum cnum;
+		typedef typename types::xnum xnum;
+
+		/// Taps of subfilter.
+		static constexpr uint Q = (N + M - 1)/M;
+
+	public:
+		typedef typename types::acc_type acc_type;
+
+		////////////////////////////
+
+	private:
+		/// Reversed coefficients zero padded to Q*M, split to phases.
+		cnum r[M][Q];
+		/// Samples not consumed yet, starting from first tap of next output.
+		std::vector<xnum> buf;
+		std::vector<xnum> phase;
+		std::vector<ct> acc;
+		std::vector<ct> part;
+
+		////////////////////////////
+
+	public:
+		explicit fir_decimator(const TC* c) {
+			for(uint p = 0; p < M; p++){
+				for(uint q = 0; q < Q; q++){
+					uint k = q*M + p;
+					r[p][q] = k < N ? c[N - 1 - k].num : cnum(0);
+				}
+			}
+			reset();
+		}
+
+		void reset() {
+			buf.assign(N - 1, xnum(0));
+		}
+
+		////////////////////////////
+
+		/**
+		 * Filter n samples from in.
+		 * @return number of samples written to out,
+		 * at most (n + M - 1)/M.
+		 */
+		template<typename TO, round_mode R = round_nearest>
+		size_t process(const TI* in, TO* out, size_t n) {
+			const size_t len = buf.size() + n;
+			buf.resize(len);
+			for(size_t i = 0; i < n; i++){
+				buf[len - n + i] = in[i].num;
+			}
+			// Output j covers buf[j*M, j*M + Q*M).
+			if(len < Q*M){
+				return 0;
+			}
+			const size_t J = (len - Q*M)/M + 1;
+
+			acc.assign(J, ct(0));
+			part.resize(J);
+			phase.resize(J + Q - 1);
+			for(uint p = 0; p < M; p++){
+				for(size_t i = 0; i < J + Q - 1; i++){
+					size_t s = i*M + p;
+					phase[i] = s < len ? buf[s] : xnum(0);
+				}
+				types::kernel(r[p], Q, phase.data(), J, part.data());
+				for(size_t j = 0; j < J; j++){
+					acc[j] += part[j];
+				}
+			}
+
+			acc_type a;
+			for(size_t j = 0; j < J; j++){
+				a.num = acc[j];
+				out[j] = requantize<TO, R>(a);
+			}
+
+			buf.erase(buf.begin(), buf.begin() + J*M);
+			return J;
+		}
+
+		////////////////////////////
+	};
+
+	/**
+	 * @class fir_interpolator
+	 * @brief Upsampling by L with zero stuffing followed by FIR of N taps.
+	 * Output L*t + p is computed by subfilter c[q*L + p] directly
+	 * on input, so zeros are never multiplied.
+	 * Coefficients should have gain L to keep amplitude.
+	 */
+	template<uint N, uint L, typename TC, typename TI>
+	class fir_interpolator {
+		static_assert(N > 0 && L > 0, "FIR must have at least one tap!");
+
+		typedef detail::fir_types<TC, TI, N> types;
+		typedef typename types::ct ct;
+		typedef typename types::cnum cnum;
+		typedef typename types::xnum xnum;
+
+		static constexpr uint Q = (N + L - 1)/L;
+
+	public:
+		typedef typename types::acc_type acc_type;
+
+		////////////////////////////
+
+	private:
+		/// Reversed subfilters, zero padded to Q taps.
+		cnum r[L][Q];
+		/// Q - 1 samples of history followed by current block.
+		std::vector<xnum> buf;
+		std::vector<ct> acc;
+
+		////////////////////////////
+
+	public:
+		explicit fir_interpolator(const TC* c) {
+			for(uint p = 0; p < L; p++){
+				for(uint q = 0; q < Q; q++){
+					uint k = q*L + p;
+					r[p][Q - 1 - q] = k < N ? c[k].num : cnum(0);
+				}
+			}
+			reset();
+		}
+
+		void reset() {
+			buf.assign(Q - 1, xnum(0));
+		}
+
+		////////////////////////////
+
+		/**
+		 * Filter n samples from in, writing n*L samples to out.
+		 */
+		template<typename TO, round_mode R = round_nearest>
+		void process(const TI* in, TO* out, size_t n) {
+			buf.resize(Q - 1 + n);
+			for(size_t i = 0; i < n; i++){
+				buf[Q - 1 + i] = in[i].num;
+			}
+			acc.resize(n);
+
+			acc_type a;
+			for(uint p = 0; p < L; p++){
+				types::kernel(r[p], Q, buf.data(), n, acc.data());
+				for(size_t i = 0; i < n; i++){
+					a.num = acc[i];
+					out[i*L + p] = requantize<TO, R>(a);
+				}
+			}
+
+			std::copy(buf.end() - (Q - 1), buf.end(), buf.begin());
+			buf.resize(Q - 1);
+		}
+
+		////////////////////////////
+	};
+
+	////////////////////////////////////
+
+} // namespace static_float
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // STATIC_FLOAT_FIR_H_
@@ -0,0 +1,440 @@
+/**
+ * @file static_float_gemm.h
+ * @date Oct 19, 2026
+ *
+ * @author Milos Subotic <milos.subotic.sm@gmail.com>
+ * @license MIT
+ *
+ * @brief Blocked matrix multiplication of static float matrices.
+ *
+ * @version 1.0
+ * Changelog:
+ * 1.0 - Initial version.
+ *
+ */
+
+#ifndef STATIC_FLOAT_GEMM_H_
+#define STATIC_FLOAT_GEMM_H_
+
+///////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+#include <thread>
+#include <algorithm>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+#include "static_float.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Height of micro-kernel tile.
+ */
+#ifndef STATIC_FLOAT_GEMM_MR
+#define STATIC_FLOAT_GEMM_MR 4
+#endif
+
+/**
+ * Width of micro-kernel tile. Row of tile accumulators should fill
+ * one or two SIMD registers.
+ */
+#ifndef STATIC_FLOAT_GEMM_NR
+#define STATIC_FLOAT_GEMM_NR 16
+#endif
+
+/**
+ * Rows of A packed at once.
+ */
+#ifndef STATIC_FLOAT_GEMM_MC
+#define STATIC_FLOAT_GEMM_MC 64
+#endif
+
+/**
+ * Columns of B packed at once.
+ */
+#ifndef STATIC_FLOAT_GEMM_NC
+#define STATIC_FLOAT_GEMM_NC 256
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+
+namespace static_float {
+
+	namespace detail {
+
+		constexpr uint gemm_mr = STATIC_FLOAT_GEMM_MR;
+		constexpr uint gemm_nr = STATIC_FLOAT_GEMM_NR;
+		constexpr uint gemm_mc = STATIC_FLOAT_GEMM_MC;
+		constexpr uint gemm_nc = STATIC_FLOAT_GEMM_NC;
+
+		static_assert(gemm_mc % gemm_mr == 0, "MC must be multiple of MR!");
+		static_assert(gemm_nc % gemm_nr == 0, "NC must be multiple of NR!");
+
+		/**
+		 * Portable kernel. Panels are packed with elements already widened
+		 * to calculation type CT, so inner loop over j is plain vector
+		 * multiply-add without conversions.
+		 */
+		template<uint K, typename CT>
+		struct gemm_kernel_generic {
+			typedef CT pack_type;
+
+			/// Packed depth of panels.
+			static constexpr uint kp = K;
+
+			/**
+			 * Pack mc x K block of row-major A to panels of gemm_mr rows,
+			 * where every panel is stored k-major: p[k*gemm_mr + i].
+			 * Missing rows are filled with 0.
+			 */
+			template<typename TA>
+			static void pack_a(
+				const TA* a,
+				size_t lda,
+				size_t mc,
+				pack_type* p
+			) {
+				for(size_t i0 = 0; i0 < mc; i0 += gemm_mr){
+					for(uint k = 0; k < K; k++){
+						for(uint i = 0; i < gemm_mr; i++){
+							p[k*gemm_mr + i] = i0 + i < mc
+								? CT(a[(i0 + i)*lda + k].num)
+								: CT(0);
+						}
+					}
+					p += K*gemm_mr;
+				}
+			}
+
+			/**
+			 * Pack K x nc block of row-major B to panels of gemm_nr
+			 * columns, where every panel is stored k-major:
+			 * p[k*gemm_nr + j]. Missing columns are filled with 0.
+			 */
+			template<typename TB>
+			static void pack_b(
+				const TB* b,
+				size_t ldb,
+				size_t nc,
+				pack_type* p
+			) {
+				for(size_t j0 = 0; j0 < nc; j0 += gemm_nr){
+					for(uint k = 0; k < K; k++){
+						for(uint j = 0; j < gemm_nr; j++){
+							p[k*gemm_nr + j] = j0 + j < nc
+								? CT(b[k*ldb + j0 + j].num)
+								: CT(0);
+						}
+					}
+					p += K*gemm_nr;
+				}
+			}
+
+			/**
+			 * gemm_mr x gemm_nr tile from packed panels.
+			 * Whole K is accumulated to acc.
+			 */
+			static void tile(
+				const pack_type* __restrict__ pa,
+				const pack_type* __restrict__ pb,
+				CT acc[gemm_mr][gemm_nr]
+			) {
+				for(uint i = 0; i < gemm_mr; i++){
+					// Row of accumulators is kept in SIMD registers.
+					CT row[gemm_nr];
+					for(uint j = 0; j < gemm_nr; j++){
+						row[j] = 0;
+					}
+					for(uint k = 0; k < K; k++){
+						CT ai = pa[k*gemm_mr + i];
+						for(uint j = 0; j < gemm_nr; j++){
+							row[j] += ai * pb[k*gemm_nr + j];
+						}
+					}
+					for(uint j = 0; j < gemm_nr; j++){
+						acc[i][j] = row[j];
+					}
+				}
+			}
+		};
+
+#ifdef __AVX2__
+		/**
+		 * Kernel for inputs which fit int16 and int32 accumulator.
+		 * Pairs of k are interleaved in panels, so vpmaddwd multiply
+		 * 16 pairs and add products of every pair to 8 int32 lanes.
+		 * Sum of pair of products must fit int32.
+		 */
+		template<uint K>
+		struct gemm_kernel_madd16 {
+			typedef int16_t pack_type;
+
+			static constexpr uint kp = (K + 1) & ~1u;
+
+			/**
+			 * Panel is stored as p[(k/2*gemm_mr + i)*2 + k%2].
+			 */
+			template<typename TA>
+			static void pack_a(
+				const TA* a,
+				size_t lda,
+				size_t mc,
+				pack_type* p
+			) {
+				for(size_t i0 = 0; i0 < mc; i0 += gemm_mr){
+					for(uint k = 0; k < kp; k++){
+						for(uint i = 0; i < gemm_mr; i++){
+							p[(k/2*gemm_mr + i)*2 + k%2] = i0 + i < mc && k < K
+								? int16_t(a[(i0 + i)*lda + k].num)
+								: int16_t(0);
+						}
+					}
+					p += kp*gemm_mr;
+				}
+			}
+
+			/**
+			 * Panel is stored as p[(k/2*gemm_nr + j)*2 + k%2].
+			 */
+			template<typename TB>
+			static void pack_b(
+				const TB* b,
+				size_t ldb,
+				size_t nc,
+				pack_type* p
+			) {
+				for(size_t j0 = 0; j0 < nc; j0 += gemm_nr){
+					for(uint k = 0; k < kp; k++){
+						for(uint j = 0; j < gemm_nr; j++){
+							p[(k/2*gemm_nr + j)*2 + k%2] = j0 + j < nc && k < K
+								? int16_t(b[k*ldb + j0 + j].num)
+								: int16_t(0);
+						}
+					}
+					p += kp*gemm_nr;
+				}
+			}
+
+			static void tile(
+				const pack_type* __restrict__ pa,
+				const pack_type* __restrict__ pb,
+				int32_t acc[gemm_mr][gemm_nr]
+			) {
+				static_assert(gemm_nr == 16, "Kernel is for NR == 16!");
+				__m256i c[gemm_mr][2];
+				for(uint i = 0; i < gemm_mr; i++){
+					c[i][0] = _mm256_setzero_si256();
+					c[i][1] = _mm256_setzero_si256();
+				}
+				for(uint k2 = 0; k2 < kp/2; k2++){
+					const __m256i* pbk = (const __m256i*)(pb + k2*gemm_nr*2);
+					__m256i b0 = _mm256_loadu_si256(pbk);
+					__m256i b1 = _mm256_loadu_si256(pbk + 1);
+					const int32_t* pak = (const int32_t*)(pa + k2*gemm_mr*2);
+					for(uint i = 0; i < gemm_mr; i++){
+						__m256i ai = _mm256_set1_epi32(pak[i]);
+						c[i][0] = _mm256_add_epi32(
+							c[i][0],
+							_mm256_madd_epi16(ai, b0)
+						);
+						c[i][1] = _mm256_add_epi32(
+							c[i][1],
+							_mm256_madd_epi16(ai, b1)
+						);
+					}
+				}
+				for(uint i = 0; i < gemm_mr; i++){
+					_mm256_storeu_si256((__m256i*)&acc[i][0], c[i][0]);
+					_mm256_storeu_si256((__m256i*)&acc[i][8], c[i][1]);
+				}
+			}
+		};
+#endif
+
+		/**
+		 * Choose kernel by types of A and B.
+		 */
+		template<uint K, typename TA, typename TB>
+		struct gemm_kernel {
+			typedef typename rt::dot<TA, TB, K>::ct ct;
+#ifdef __AVX2__
+			static constexpr bool madd16 =
+				std::is_same<ct, int32_t>::value
+				&& TA::b <= 15
+				&& TB::b <= 15
+				&& TA::b + TB::b + 1 < 31
+				&& gemm_nr == 16;
+#else
+			static constexpr bool madd16 = false;
+#endif
+			typedef typename std::conditional<
+				madd16,
+#ifdef __AVX2__
+				gemm_kernel_madd16<K>,
+#else
+				void,
+#endif
+				gemm_kernel_generic<K, ct>
+			>::type type;
+		};
+
+	} // namespace detail
+
+	////////////////////////////////////
+
+	namespace detail {
+		/**
+		 * Split [0, n) to contiguous chunks and call f(begin, end) for
+		 * every chunk in its own thread.
+		 * @param threads number of threads, 1 for calling thread only.
+		 */
+		template<typename F>
+		void parallel_for(size_t n, uint threads, const F& f) {
+			if(threads > n){
+				threads = n;
+			}
+			if(threads <= 1){
+				f(size_t(0), n);
+				return;
+			}
+			std::vector<std::thread> pool;
+			for(uint id = 1; id < threads; id++){
+				pool.emplace_back(f, n*id/threads, n*(id + 1)/threads);
+			}
+			f(size_t(0), n/threads);
+			for(auto& th : pool){
+				th.join();
+			}
+		}
+	} // namespace detail
+
+	/**
+	 * Output stage of gemm which just requantize accumulator.
+	 */
+	template<typename TC, round_mode R = round_nearest>
+	struct gemm_requantize {
+		template<typename AT>
+		TC operator()(size_t i, size_t j, const AT& acc) const {
+			(void)i;
+			(void)j;
+			return requantize<TC, R>(acc);
+		}
+	};
+
+	/**
+	 * C = op(A*B), where A is m x K, B is K x n and C is m x n row-major
+	 * matrices of static floats.
+	 * Products are accumulated in rt::dot<TA, TB, K>::rt, which is exact,
+	 * and then c[i][j] = op(i, j, acc) make element of C, for example with
+	 * adding bias and requantization.
+	 * Work is split to threads by tiles of gemm_mc x gemm_nc.
+	 * @param K common dimension
+	 * @param threads number of threads, 1 for calling thread only.
+	 */
+	template<uint K, typename TA, typename TB, typename TC, typename OP>
+	void gemm_op(
+		size_t m,
+		size_t n,
+		const TA* a,
+		size_t lda,
+		const TB* b,
+		size_t ldb,
+		TC* c,
+		size_t ldc,
+		const OP& op,
+		uint threads = 1
+	) {
+		using namespace detail;
+
+		typedef rt::dot<TA, TB, K> d;
+		typedef typename d::ct ct;
+		typedef typename d::rt at;
+		typedef typename gemm_kernel<K, TA, TB>::type kernel;
+		typedef typename kernel::pack_type pt;
+		constexpr uint kp = kernel::kp;
+
+		const size_t m_tiles = (m + gemm_mc - 1) / gemm_mc;
+		const size_t n_tiles = (n + gemm_nc - 1) / gemm_nc;
+
+		auto worker = [&](size_t begin, size_t end) {
+			std::vector<pt> pa(gemm_mc*kp);
+			std::vector<pt> pb(gemm_nc*kp);
+			size_t packed_jc = size_t(-1);
+			ct acc[gemm_mr][gemm_nr];
+			at acc_sf;
+
+			// Tiles are ordered by n, so packed panel of B is reused.
+			for(size_t t = begin; t < end; t++){
+				size_t jc = (t / m_tiles) * gemm_nc;
+				size_t ic = (t % m_tiles) * gemm_mc;
+				size_t nc = std::min(size_t(gemm_nc), n - jc);
+				size_t mc = std::min(size_t(gemm_mc), m - ic);
+
+				if(jc != packed_jc){
+					kernel::pack_b(b + jc, ldb, nc, pb.data());
+					packed_jc = jc;
+				}
+				kernel::pack_a(a + ic*lda, lda, mc, pa.data());
+
+				for(size_t jr = 0; jr < nc; jr += gemm_nr){
+					for(size_t ir = 0; ir < mc; ir += gemm_mr){
+						kernel::tile(
+							pa.data() + ir*kp,
+							pb.data() + jr*kp,
+							acc
+						);
+
+						// Output stage of tile.
+						size_t mr = std::min(size_t(gemm_mr), mc - ir);
+						size_t nr = std::min(size_t(gemm_nr), nc - jr);
+						size_t i0 = ic + ir;
+						size_t j0 = jc + jr;
+						for(size_t i = 0; i < mr; i++){
+							for(size_t j = 0; j < nr; j++){
+								acc_sf.num = acc[i][j];
+								c[(i0 + i)*ldc + j0 + j] =
+									op(i0 + i, j0 + j, acc_sf);
+							}
+						}
+					}
+				}
+			}
+		};
+
+		parallel_for(m_tiles*n_tiles, threads, worker);
+	}
+
+	/**
+	 * C = A*B requantized to TC with rounding R and saturation.
+	 * @see gemm_op
+	 */
+	template<uint K, round_mode R = round_nearest,
+		typename TA, typename TB, typename TC>
+	void gemm(
+		size_t m,
+		size_t n,
+		const TA* a,
+		size_t lda,
+		const TB* b,
+		size_t ldb,
+		TC* c,
+		size_t ldc,
+		uint threads = 1
+	) {
+		gemm_op<K>(
+			m, n, a, lda, b, ldb, c, ldc,
+			gemm_requantize<TC, R>(),
+			threads
+		);
+	}
+
+	////////////////////////////////////
+
+} // namespace static_float
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // STATIC_FLOAT_GEMM_H_
@@ -0,0 +1,291 @@
+/**
+ * @file static_float_iir.h
+ * @date Oct 19, 2026
+ *
+ * @author Milos Subotic <milos.subotic.sm@gmail.com>
+ * @license MIT
+ *
+ * @brief Multichannel IIR biquad cascade.
+ *
+ * @version 1.0
+ * Changelog:
+ * 1.0 - Initial version.
+ *
+ */
+
+#ifndef STATIC_FLOAT_IIR_H_
+#define STATIC_FLOAT_IIR_H_
+
+///////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+#include <type_traits>
+#include <cassert>
+
+#include "static_float.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+namespace static_float {
+
+	/**
+	 * @class biquad
+	 * @brief Direct form I biquad section for many channels.
+	 * y[n] = b0*x[n] + b1*x[n-1] + b2*x[n-2] - a1*y[n-1] - a2*y[n-2]
+	 * Sum is exact in acc_type and it is requantized with rounding R
+	 * and saturation to state type TS, which is also output type.
+	 * Samples are interleaved by channels, ie. in[t*channels + ch].
+	 * State of every channel is kept in separate array (SoA),
+	 * so loop over channels is vectorized.
+	 * @param TB feedforward coefficient type
+	 * @param TA feedback coefficient type
+	 * @param TX input type
+	 * @param TS state and output type
+	 * @param R rounding of state
+	 */
+	template<typename TB, typename TA, typename TX, typename TS,
+		round_mode R = round_nearest>
+	class biquad {
+	public:
+		typedef TX in_type;
+		typedef TS out_type;
+
+		/// Feedforward sum.
+		typedef typename rt::dot<TB, TX, 3>::rt bx_type;
+		/// Feedback sum.
+		typedef typename rt::dot<TA, TS, 2>::rt ay_type;
+		typedef rt::add_sub<bx_type, ay_type> _s;
+		typedef typename _s::rt acc_type;
+
+		static_assert(
+			acc_type::b < 64,
+			"Biquad accumulator is wider than 64 bits!"
+		);
+
+		////////////////////////////
+
+	private:
+		typedef typename acc_type::num_type ct;
+		/// Single product is at most 2^(B1+B2) in absolute value,
+		/// so it needs B1+B2+1 bits and sign.
+		typedef typename sf<TB::b + TX::b + 1, 0>::num_type bpt;
+		typedef typename sf<TA::b + TS::b + 1, 0>::num_type apt;
+		typedef typename TB::num_type bnum;
+		typedef typename TA::num_type anum;
+		typedef typename TX::num_type xnum;
+		typedef typename TS::num_type snum;
+
+		bnum b0, b1, b2;
+		anum a1, a2;
+
+		uint ch;
+		std::vector<xnum> x1, x2;
+		std::vector<snum> y1, y2;
+
+		////////////////////////////
+
+	public:
+		/**
+		 * @param b feedforward coefficients b0, b1, b2
+		 * @param a feedback coefficients a1, a2, with a0 = 1
+		 */
+		biquad(uint channels, const TB b[3], const TA a[2])
+			: b0(b[0].num), b1(b[1].num), b2(b[2].num),
+			a1(a[0].num), a2(a[1].num),
+			ch(channels) {
+			reset();
+		}
+
+		uint channels() const {
+			return ch;
+		}
+
+		void reset() {
+			x1.assign(ch, xnum(0));
+			x2.assign(ch, xnum(0));
+			y1.assign(ch, snum(0));
+			y2.assign(ch, snum(0));
+		}
+
+		////////////////////////////
+
+		/**
+		 * Filter n frames of channels() samples.
+		 */
+		void process(const TX* in, TS* out, size_t n) {
+			if(ch == 1){
+				// Nothing to vectorize, state is kept in registers.
+				xnum xs1 = x1[0], xs2 = x2[0];
+				snum ys1 = y1[0], ys2 = y2[0];
+				for(size_t t = 0; t < n; t++){
+					xnum x0 = in[t].num;
+					snum y0 = step(x0, xs1, xs2, ys1, ys2,
+							b0, b1, b2, a1, a2);
+					xs2 = xs1;
+					xs1 = x0;
+					ys2 = ys1;
+					ys1 = y0;
+					out[t].num = y0;
+				}
+				x1[0] = xs1;
+				x2[0] = xs2;
+				y1[0] = ys1;
+				y2[0] = ys2;
+				return;
+			}
+			for(size_t t = 0; t < n; t++){
+				frame(
+					in + t*ch, out + t*ch,
+					x1.data(), x2.data(), y1.data(), y2.data(),
+					ch,
+					b0, b1, b2, a1, a2
+				);
+			}
+		}
+
+		////////////////////////////
+
+	private:
+		static snum step(
+			xnum x0, xnum x1, xnum x2,
+			snum y1, snum y2,
+			bpt b0, bpt b1, bpt b2,
+			apt a1, apt a2
+		) {
+			ct bx = ct(b0*bpt(x0))
+				+ ct(b1*bpt(x1))
+				+ ct(b2*bpt(x2));
+			ct ay = ct(a1*apt(y1))
+				+ ct(a2*apt(y2));
+			acc_type acc;
+			acc.num = (bx << _s::SH1) - (ay << _s::SH2);
+			return requantize<TS, R>(acc).num;
+		}
+
+		/**
+		 * One sample of every channel.
+		 * Arrays never alias, which enables vectorization.
+		 */
+		static void frame(
+			const TX* __restrict x,
+			TS* __restrict y,
+			xnum* __restrict x1,
+			xnum* __restrict x2,
+			snum* __restrict y1,
+			snum* __restrict y2,
+			size_t channels,
+			bpt b0, bpt b1, bpt b2,
+			apt a1, apt a2
+		) {
+			for(size_t c = 0; c < channels; c++){
+				xnum x0 = x[c].num;
+				snum y0 = step(x0, x1[c], x2[c], y1[c], y2[c],
+						b0, b1, b2, a1, a2);
+
+				x2[c] = x1[c];
+				x1[c] = x0;
+				y2[c] = y1[c];
+				y1[c] = y0;
+				y[c].num = y0;
+			}
+		}
+
+		////////////////////////////
+	};
+
+	////////////////////////////////////
+
+	/**
+	 * @class iir_cascade
+	 * @brief Cascade of sections, output of one is input of next.
+	 * Every section have own types, and they are checked to match.
+	 * Usage: iir_cascade<biquad<...>, biquad<...>> f(s0, s1);
+	 */
+	template<typename S, typename... Rest>
+	class iir_cascade {
+		typedef iir_cascade<Rest...> rest_type;
+		static_assert(
+			std::is_same<
+				typename S::out_type,
+				typename rest_type::in_type
+			>::value,
+			"Output type of section must be input type of next section!"
+		);
+
+	public:
+		typedef typename S::in_type in_type;
+		typedef typename rest_type::out_type out_type;
+
+		////////////////////////////
+
+	private:
+		S first;
+		rest_type rest;
+		std::vector<typename S::out_type> tmp;
+
+		////////////////////////////
+
+	public:
+		iir_cascade(const S& s, const Rest&... r)
+			: first(s), rest(r...) {
+			assert(first.channels() == rest.channels());
+		}
+
+		uint channels() const {
+			return first.channels();
+		}
+
+		void reset() {
+			first.reset();
+			rest.reset();
+		}
+
+		void process(const in_type* in, out_type* out, size_t n) {
+			tmp.resize(n*channels());
+			first.process(in, tmp.data(), n);
+			rest.process(tmp.data(), out, n);
+		}
+
+		////////////////////////////
+	};
+
+	template<typename S>
+	class iir_cascade<S> {
+	public:
+		typedef typename S::in_type in_type;
+		typedef typename S::out_type out_type;
+
+		////////////////////////////
+
+	private:
+		S first;
+
+		////////////////////////////
+
+	public:
+		explicit iir_cascade(const S& s)
+			: first(s) {
+		}
+
+		uint channels() const {
+			return first.channels();
+		}
+
+		void reset() {
+			first.reset();
+		}
+
+		void process(const in_type* in, out_type* out, size_t n) {
+			first.process(in, out, n);
+		}
+
+		////////////////////////////
+	};
+
+	////////////////////////////////////
+
+} // namespace static_float
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // STATIC_FLOAT_IIR_H_
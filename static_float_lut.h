@@ -0,0 +1,361 @@
+/**
+ * @file static_float_lut.h
+ * @date Oct 19, 2026
+ *
+ * @author Milos Subotic <milos.subotic.sm@gmail.com>
+ * @license MIT
+ *
+ * @brief Lookup tables with interpolation for unary functions
+ * of static floats.
+ *
+ * @version 1.0
+ * Changelog:
+ * 1.0 - Initial version.
+ *
+ */
+
+#ifndef STATIC_FLOAT_LUT_H_
+#define STATIC_FLOAT_LUT_H_
+
+///////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+#include <cmath>
+#include <type_traits>
+
+#include "static_float.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+namespace static_float {
+
+	/**
+	 * Interpolation between entries of table.
+	 */
+	enum lut_interp {
+		/// Entry nearest to argument.
+		lut_nearest,
+		/// Line through ends of segment.
+		lut_linear,
+		/// Parabola through ends and middle of segment.
+		lut_quadratic
+	};
+
+	namespace detail {
+
+		constexpr long double clamp_ld(long double v, long double lo, long double hi) {
+			return v < lo ? lo : v > hi ? hi : v;
+		}
+
+		/**
+		 * True if F have static member function f(double).
+		 */
+		template<typename F>
+		struct has_static_f {
+			template<typename T>
+			static constexpr bool test(decltype(T::f(0.0))*) {
+				return true;
+			}
+			template<typename T>
+			static constexpr bool test(...) {
+				return false;
+			}
+			static constexpr bool value = test<F>(nullptr);
+		};
+
+		/**
+		 * Layout of table for In -> Out, with 2^IB segments.
+		 * Arguments are offset to unsigned index u of NB bits,
+		 * top IB bits of u select segment and remaining RB bits interpolate.
+		 * Only top RR bits of remainder are used, so products of them
+		 * stay in 64 bits for int32 coefficients and in 128 bits for int64.
+		 * Entries have G guard bits more than Out.
+		 */
+		template<typename In, typename Out, uint IndexBits, lut_interp I>
+		struct lut_layout {
+			static constexpr bool in_signed = is_signed_type((In*)nullptr);
+			static constexpr bool out_signed = is_signed_type((Out*)nullptr);
+			static constexpr uint NB = In::b + (in_signed ? 1 : 0);
+			/// Narrow input is tabulated for every value.
+			static constexpr bool full = In::b <= 16;
+			static constexpr uint IB = full || IndexBits > NB ? NB : IndexBits;
+			static constexpr uint RB = NB - IB;
+			static constexpr uint RR = RB < 16 ? RB : 16;
+			static constexpr lut_interp interp = full ? lut_nearest : I;
+			static constexpr uint G = interp == lut_nearest ? 0 : 8;
+			static constexpr uint n = (1u << IB) + 1;
+			/// Entries of slopes, which nearest doesn't need.
+			static constexpr uint ns = interp == lut_nearest ? 1 : n;
+			static constexpr int64_t offset = in_signed ? int64_t(1) << In::b : 0;
+
+			static_assert(IB <= 24, "Table is too big!");
+			static_assert(Out::b + G < 56, "Output type is too wide!");
+
+			/// Coefficients need sign and range of differences.
+			typedef typename std::conditional<
+				Out::b + G + 2 < 32,
+				int32_t,
+				int64_t
+			>::type vt;
+
+			/// Range of Out in units of entries.
+			static constexpr long double max =
+				(pow2(Out::b) - 1)*pow2(G);
+			static constexpr long double min =
+				out_signed ? -pow2(Out::b)*pow2(G) : 0;
+
+			/// Argument at position t of segment k, t in [0, 1].
+			static constexpr double arg(uint k, long double t) {
+				return double(
+					((k + t)*pow2(RB) - offset)*pow2i(In::e)
+				);
+			}
+
+			/// Value of function, clamped to Out, in units of entries.
+			template<typename F>
+			static constexpr long double val(const F& f, double x) {
+				return clamp_ld(f(x)*pow2i(int(G) - Out::e), min, max);
+			}
+
+			/**
+			 * Coefficient j of segment k, from values at ends and middle.
+			 */
+			template<typename F>
+			static constexpr long double coef(const F& f, uint k, uint j) {
+				return j == 0
+					? val(f, arg(k, 0))
+					: interp == lut_linear
+						? (j == 1 ? val(f, arg(k, 1)) - val(f, arg(k, 0)) : 0)
+						: interp == lut_quadratic
+							? j == 1
+								? -3*val(f, arg(k, 0))
+									+ 4*val(f, arg(k, 0.5L))
+									- val(f, arg(k, 1))
+								: 2*val(f, arg(k, 0))
+									- 4*val(f, arg(k, 0.5L))
+									+ 2*val(f, arg(k, 1))
+							: 0;
+			}
+
+			template<typename F>
+			static constexpr vt entry(const F& f, uint k, uint j) {
+				return vt(round_ld(coef(f, k, j)));
+			}
+		};
+
+		/// Adapter of static F::f() for constexpr evaluation.
+		template<typename F>
+		struct static_f {
+			constexpr double operator()(double x) const {
+				return F::f(x);
+			}
+		};
+
+		/**
+		 * Table from static constexpr F::f(double), at compile time.
+		 */
+		template<typename F, typename L, typename S, typename SS>
+		struct lut_static_table;
+
+		template<typename F, typename L, uint... K, uint... KS>
+		struct lut_static_table<F, L, index_seq<K...>, index_seq<KS...>> {
+			typedef typename L::vt vt;
+			static const vt c0[L::n];
+			static const vt c1[L::ns];
+			static const vt c2[L::ns];
+		};
+
+		template<typename F, typename L, uint... K, uint... KS>
+		const typename L::vt
+		lut_static_table<F, L, index_seq<K...>, index_seq<KS...>>::c0[L::n]
+			= { L::entry(static_f<F>(), K, 0)... };
+
+		template<typename F, typename L, uint... K, uint... KS>
+		const typename L::vt
+		lut_static_table<F, L, index_seq<K...>, index_seq<KS...>>::c1[L::ns]
+			= { L::entry(static_f<F>(), KS, 1)... };
+
+		template<typename F, typename L, uint... K, uint... KS>
+		const typename L::vt
+		lut_static_table<F, L, index_seq<K...>, index_seq<KS...>>::c2[L::ns]
+			= { L::entry(static_f<F>(), KS, 2)... };
+
+		/**
+		 * Table from default constructed F, built on first use.
+		 * Initialization of function local static is thread-safe.
+		 */
+		template<typename F, typename L>
+		struct lut_lazy_table {
+			typedef typename L::vt vt;
+			std::vector<vt> c0, c1, c2;
+
+			lut_lazy_table()
+				: c0(L::n), c1(L::ns), c2(L::ns) {
+				const F f = F();
+				for(uint k = 0; k < L::n; k++){
+					c0[k] = L::entry(f, k, 0);
+				}
+				for(uint k = 0; k < L::ns; k++){
+					c1[k] = L::entry(f, k, 1);
+					c2[k] = L::entry(f, k, 2);
+				}
+			}
+
+			static const lut_lazy_table& get() {
+				static const lut_lazy_table t;
+				return t;
+			}
+		};
+
+		/**
+		 * Lookup of n arguments.
+		 * Arrays never alias, so loop is vectorized with gathers.
+		 */
+		template<typename L, typename In, typename Out>
+		void lut_kernel(
+			const typename L::vt* __restrict c0,
+			const typename L::vt* __restrict c1,
+			const typename L::vt* __restrict c2,
+			const In* __restrict in,
+			Out* __restrict out,
+			size_t n
+		) {
+			typedef typename Out::num_type onum;
+			// Index in 32 bits where possible, for gathers.
+			typedef typename std::conditional<
+				L::NB < 31,
+				int32_t,
+				int64_t
+			>::type ut;
+			// Products of coefficients and RR bits of remainder.
+			typedef typename std::conditional<
+				std::is_same<typename L::vt, int32_t>::value,
+				int64_t,
+				int128_t
+			>::type pt;
+			constexpr uint SH = L::RB - L::RR;
+			constexpr int64_t mask = (int64_t(1) << L::RR) - 1;
+			constexpr int64_t half = L::RB ? int64_t(1) << (L::RB - 1) : 0;
+			constexpr int64_t max = (int64_t(1) << Out::b) - 1;
+			constexpr int64_t min = L::out_signed ? -max - 1 : 0;
+			for(size_t i = 0; i < n; i++){
+				const ut u = ut(in[i].num) + ut(L::offset);
+				pt y;
+				if(L::interp == lut_nearest){
+					y = c0[int((u + half) >> L::RB)];
+				}else{
+					const int k = int(u >> L::RB);
+					const pt r = pt(u >> SH) & mask;
+					pt acc = L::interp == lut_quadratic
+						? pt(c1[k]) + ((pt(c2[k])*r) >> L::RR)
+						: pt(c1[k]);
+					y = pt(c0[k]) + ((acc*r) >> L::RR);
+					y = round_shift<round_nearest, L::G>(y);
+				}
+				y = y > max ? max : y < min ? min : y;
+				out[i].num = onum(y);
+			}
+		}
+
+	} // namespace detail
+
+	////////////////////////////////////
+
+	/**
+	 * @class sf_lut
+	 * @brief Function F tabulated for arguments In and values Out.
+	 * Table have 2^IndexBits segments over range of In,
+	 * and values between entries are interpolated with Interp.
+	 * If In have at most 16 bits, every value of In is tabulated,
+	 * so result is exactly rounded F.
+	 * If F have static constexpr double f(double),
+	 * table is generated at compile time.
+	 * Otherwise F is callable with operator()(double) const,
+	 * which is default constructed, and table is generated on first use.
+	 * Values are rounded to nearest Out and saturated.
+	 * @param F function
+	 * @param In argument type
+	 * @param Out result type
+	 * @param IndexBits log2 of segments for wide In
+	 * @param Interp interpolation in segment
+	 */
+	template<
+		typename F,
+		typename In,
+		typename Out,
+		uint IndexBits = 8,
+		lut_interp Interp = lut_linear
+	>
+	class sf_lut {
+	public:
+		typedef detail::lut_layout<In, Out, IndexBits, Interp> layout;
+		typedef typename layout::vt vt;
+
+		static constexpr bool compile_time = detail::has_static_f<F>::value;
+		/// Entries, 2^IndexBits + 1 or 2^(bits of In) + 1 for narrow In.
+		static constexpr size_t size = layout::n;
+
+		////////////////////////////
+
+	private:
+		typedef detail::lut_static_table<
+			F,
+			layout,
+			typename detail::make_index_seq<layout::n>::type,
+			typename detail::make_index_seq<layout::ns>::type
+		> static_table;
+		typedef detail::lut_lazy_table<F, layout> lazy_table;
+
+		const vt* c0;
+		const vt* c1;
+		const vt* c2;
+
+		////////////////////////////
+
+	public:
+		sf_lut() {
+			init(std::integral_constant<bool, compile_time>());
+		}
+
+		////////////////////////////
+
+	public:
+		Out operator()(const In& x) const {
+			Out y;
+			detail::lut_kernel<layout>(c0, c1, c2, &x, &y, 1);
+			return y;
+		}
+
+		/**
+		 * out[i] = F(in[i]) for n arguments.
+		 */
+		void operator()(const In* in, Out* out, size_t n) const {
+			detail::lut_kernel<layout>(c0, c1, c2, in, out, n);
+		}
+
+		////////////////////////////
+
+	private:
+		void init(std::true_type) {
+			c0 = static_table::c0;
+			c1 = static_table::c1;
+			c2 = static_table::c2;
+		}
+
+		void init(std::false_type) {
+			const lazy_table& t = lazy_table::get();
+			c0 = t.c0.data();
+			c1 = t.c1.data();
+			c2 = t.c2.data();
+		}
+
+		////////////////////////////
+	};
+
+	////////////////////////////////////
+
+} // namespace static_float
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // STATIC_FLOAT_LUT_H_
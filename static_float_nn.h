@@ -0,0 +1,409 @@
+/**
+ * @file static_float_nn.h
+ * @date Oct 19, 2026
+ *
+ * @author Milos Subotic <milos.subotic.sm@gmail.com>
+ * @license MIT
+ *
+ * @brief Quantized neural network layers on static float tensors.
+ *
+ * @version 1.0
+ * Changelog:
+ * 1.0 - Initial version.
+ *
+ */
+
+#ifndef STATIC_FLOAT_NN_H_
+#define STATIC_FLOAT_NN_H_
+
+///////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+#include <cmath>
+#include <cassert>
+
+#include "static_float.h"
+#include "static_float_gemm.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+namespace static_float {
+
+	/*
+	 * Layers take static float types of inputs, weights and biases,
+	 * accumulate exactly in type given by rt::dot for their number of
+	 * taps, add bias and requantize to output type. Because requantize
+	 * saturates, usf output type make ReLU for free.
+	 */
+	namespace nn {
+
+		/**
+		 * @class tensor
+		 * @brief Tensor of c channels of h x w planes, CHW layout.
+		 */
+		template<typename T>
+		class tensor {
+		public:
+			typedef T value_type;
+
+			uint c;
+			uint h;
+			uint w;
+			std::vector<T> data;
+
+			////////////////////////////
+
+		public:
+			tensor()
+				: c(0), h(0), w(0) {
+			}
+
+			tensor(uint c, uint h, uint w)
+				: c(c), h(h), w(w), data(size_t(c)*h*w) {
+			}
+
+			////////////////////////////
+
+		public:
+			T& operator()(uint ch, uint y, uint x) {
+				return data[(size_t(ch)*h + y)*w + x];
+			}
+
+			const T& operator()(uint ch, uint y, uint x) const {
+				return data[(size_t(ch)*h + y)*w + x];
+			}
+
+			T* channel(uint ch) {
+				return &data[size_t(ch)*h*w];
+			}
+
+			const T* channel(uint ch) const {
+				return &data[size_t(ch)*h*w];
+			}
+
+			size_t size() const {
+				return data.size();
+			}
+
+			////////////////////////////
+		};
+
+		/**
+		 * Size of output with "same" padding of k/2.
+		 */
+		inline uint out_size(uint in, uint k, uint stride) {
+			return (in + 2*(k/2) - k)/stride + 1;
+		}
+
+		////////////////////////////////
+
+		namespace detail {
+			/**
+			 * Output stage: add bias of row to accumulator and requantize.
+			 */
+			template<typename TO, round_mode R, typename TBias>
+			struct bias_requantize {
+				const TBias* bias;
+
+				template<typename AT>
+				TO operator()(size_t i, size_t j, const AT& acc) const {
+					(void)j;
+					return requantize<TO, R>(acc + bias[i]);
+				}
+			};
+
+			/**
+			 * Unfold patches of input with zero padding to matrix
+			 * of (c*KH*KW) x (oh*ow), so convolution is one gemm.
+			 */
+			template<uint KH, uint KW, typename TI>
+			void im2col(
+				const tensor<TI>& in,
+				uint stride,
+				uint oh,
+				uint ow,
+				TI* col,
+				uint threads
+			) {
+				const int ph = KH/2;
+				const int pw = KW/2;
+				const size_t n = size_t(oh)*ow;
+				TI zero;
+				zero.num = 0;
+				static_float::detail::parallel_for(
+					size_t(in.c)*KH*KW,
+					threads,
+					[&](size_t begin, size_t end) {
+						for(size_t r = begin; r < end; r++){
+							uint ch = r / (KH*KW);
+							int ky = (r / KW) % KH;
+							int kx = r % KW;
+							TI* dst = col + r*n;
+							for(uint y = 0; y < oh; y++){
+								int iy = int(y*stride) + ky - ph;
+								bool row_in = iy >= 0 && iy < int(in.h);
+								for(uint x = 0; x < ow; x++){
+									int ix = int(x*stride) + kx - pw;
+									dst[y*ow + x] =
+										row_in && ix >= 0 && ix < int(in.w)
+										? in(ch, iy, ix)
+										: zero;
+								}
+							}
+						}
+					}
+				);
+			}
+		} // namespace detail
+
+		/**
+		 * 2D convolution with "same" padding.
+		 * Weights are [out.c][CI][KH][KW], bias is [out.c].
+		 * Accumulator is rt::dot<TW, TI, CI*KH*KW>::rt, bias is added to it
+		 * and sum is requantized to TO with rounding R.
+		 * Output tensor must be allocated.
+		 */
+		template<uint KH, uint KW, uint CI, round_mode R = round_nearest,
+			typename TI, typename TW, typename TBias, typename TO>
+		void conv2d(
+			const tensor<TI>& in,
+			const TW* w,
+			const TBias* bias,
+			tensor<TO>& out,
+			uint stride = 1,
+			uint threads = 1
+		) {
+			constexpr uint K = CI*KH*KW;
+			assert(in.c == CI);
+			assert(out.h == out_size(in.h, KH, stride));
+			assert(out.w == out_size(in.w, KW, stride));
+
+			const size_t n = size_t(out.h)*out.w;
+			std::vector<TI> col(K*n);
+			detail::im2col<KH, KW>(in, stride, out.h, out.w, col.data(),
+					threads);
+
+			detail::bias_requantize<TO, R, TBias> op = { bias };
+			gemm_op<K>(
+				out.c, n,
+				w, K,
+				col.data(), n,
+				out.data.data(), n,
+				op,
+				threads
+			);
+		}
+
+		/**
+		 * Depthwise 2D convolution with "same" padding.
+		 * Weights are [c][KH][KW], bias is [c].
+		 * Every channel is padded once to plane of accumulator type,
+		 * so inner loop over x is without bound checks and vectorized.
+		 */
+		template<uint KH, uint KW, round_mode R = round_nearest,
+			typename TI, typename TW, typename TBias, typename TO>
+		void depthwise_conv2d(
+			const tensor<TI>& in,
+			const TW* w,
+			const TBias* bias,
+			tensor<TO>& out,
+			uint stride = 1,
+			uint threads = 1
+		) {
+			typedef rt::dot<TW, TI, KH*KW> d;
+			typedef typename d::ct ct;
+			assert(out.c == in.c);
+			assert(out.h == out_size(in.h, KH, stride));
+			assert(out.w == out_size(in.w, KW, stride));
+
+			const uint ph = KH/2;
+			const uint pw = KW/2;
+			const uint pad_w = in.w + 2*pw;
+			const uint pad_h = in.h + 2*ph;
+
+			static_float::detail::parallel_for(
+				in.c,
+				threads,
+				[&](size_t begin, size_t end) {
+					std::vector<ct> pad(size_t(pad_h)*pad_w);
+					std::vector<ct> acc(out.w);
+					typename d::rt acc_sf;
+					for(size_t ch = begin; ch < end; ch++){
+						for(uint y = 0; y < pad_h; y++){
+							for(uint x = 0; x < pad_w; x++){
+								bool inside = y >= ph && y - ph < in.h
+									&& x >= pw && x - pw < in.w;
+								pad[y*pad_w + x] = inside
+									? ct(in(ch, y - ph, x - pw).num)
+									: ct(0);
+							}
+						}
+
+						const TW* wc = w + ch*KH*KW;
+						for(uint y = 0; y < out.h; y++){
+							for(uint x = 0; x < out.w; x++){
+								acc[x] = 0;
+							}
+							for(uint ky = 0; ky < KH; ky++){
+								const ct* row = &pad[(y*stride + ky)*pad_w];
+								for(uint kx = 0; kx < KW; kx++){
+									ct wk = ct(wc[ky*KW + kx].num);
+									for(uint x = 0; x < out.w; x++){
+										acc[x] += wk * row[x*stride + kx];
+									}
+								}
+							}
+							for(uint x = 0; x < out.w; x++){
+								acc_sf.num = acc[x];
+								out(ch, y, x) = requantize<TO, R>(
+									acc_sf + bias[ch]
+								);
+							}
+						}
+					}
+				}
+			);
+		}
+
+		/**
+		 * Fully connected layer, out[i] = in . w[i] + bias[i].
+		 * Weights are [n][K].
+		 */
+		template<uint K, round_mode R = round_nearest,
+			typename TI, typename TW, typename TBias, typename TO>
+		void fully_connected(
+			const TI* in,
+			const TW* w,
+			const TBias* bias,
+			TO* out,
+			size_t n,
+			uint threads = 1
+		) {
+			static_float::detail::parallel_for(
+				n,
+				threads,
+				[&](size_t begin, size_t end) {
+					for(size_t i = begin; i < end; i++){
+						auto acc = dot<K>(w + i*K, in);
+						out[i] = requantize<TO, R>(acc + bias[i]);
+					}
+				}
+			);
+		}
+
+		/**
+		 * Rectified linear unit, negative numbers are clamped to 0.
+		 */
+		template<uint B, int E>
+		usf<B, E> relu(const sf<B, E>& x) {
+			usf<B, E> r;
+			r.num = x.num < 0 ? 0 : x.num;
+			return r;
+		}
+
+		template<uint B, int E>
+		void relu(const tensor<sf<B, E>>& in, tensor<usf<B, E>>& out) {
+			assert(in.size() == out.size());
+			const sf<B, E>* src = in.data.data();
+			usf<B, E>* dst = out.data.data();
+			for(size_t i = 0; i < in.size(); i++){
+				dst[i] = relu(src[i]);
+			}
+		}
+
+		/**
+		 * Clamp to [lo, hi] in place.
+		 */
+		template<typename T>
+		void clamp(tensor<T>& t, const T& lo, const T& hi) {
+			T* p = t.data.data();
+			for(size_t i = 0; i < t.size(); i++){
+				p[i].num = p[i].num < lo.num
+					? lo.num
+					: p[i].num > hi.num ? hi.num : p[i].num;
+			}
+		}
+
+		////////////////////////////////
+
+		/**
+		 * @class activation_lut
+		 * @brief Activation function tabulated for every value of In.
+		 * Table have 2^(B+1) entries for sf<B, E> and 2^B for usf<B, E>,
+		 * so In must be narrow.
+		 */
+		template<typename In, typename Out>
+		class activation_lut {
+			static_assert(In::b <= 16, "Input type is too wide for table!");
+
+			static constexpr bool in_signed =
+				static_float::detail::is_signed_type((In*)nullptr);
+			static constexpr size_t offset = in_signed
+				? size_t(1) << In::b
+				: 0;
+
+			std::vector<Out> table;
+
+			////////////////////////////
+
+		public:
+			/**
+			 * @param f function of double, rounded to nearest Out.
+			 */
+			template<typename F>
+			explicit activation_lut(F f)
+				: table(offset + (size_t(1) << In::b)) {
+				for(size_t i = 0; i < table.size(); i++){
+					double x = std::ldexp(double(int64_t(i) - int64_t(offset)),
+							In::e);
+					double y = std::round(std::ldexp(f(x), -Out::e));
+					double max = std::ldexp(1.0, Out::b) - 1;
+					double min = static_float::detail::is_signed_type(
+							(Out*)nullptr) ? -max - 1 : 0;
+					y = y > max ? max : y < min ? min : y;
+					table[i].num = typename Out::num_type(y);
+				}
+			}
+
+			////////////////////////////
+
+		public:
+			Out operator()(const In& x) const {
+				return table[size_t(int64_t(x.num) + int64_t(offset))];
+			}
+
+			void operator()(const tensor<In>& in, tensor<Out>& out) const {
+				assert(in.size() == out.size());
+				const In* src = in.data.data();
+				Out* dst = out.data.data();
+				for(size_t i = 0; i < in.size(); i++){
+					dst[i] = (*this)(src[i]);
+				}
+			}
+
+			////////////////////////////
+		};
+
+		template<typename In, typename Out>
+		activation_lut<In, Out> sigmoid_lut() {
+			return activation_lut<In, Out>([](double x) {
+				return 1/(1 + std::exp(-x));
+			});
+		}
+
+		template<typename In, typename Out>
+		activation_lut<In, Out> tanh_lut() {
+			return activation_lut<In, Out>([](double x) {
+				return std::tanh(x);
+			});
+		}
+
+		////////////////////////////////
+
+	} // namespace nn
+
+} // namespace static_float
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // STATIC_FLOAT_NN_H_
@@ -0,0 +1,405 @@
+/**
+ * @file static_float_parallel.h
+ * @date Oct 19, 2026
+ *
+ * @author Milos Subotic <milos.subotic.sm@gmail.com>
+ * @license MIT
+ *
+ * @brief Deterministic parallel map, reduce and scan of static float arrays.
+ * Sums are exact, so results are same for any count of threads.
+ *
+ * @version 1.0
+ * Changelog:
+ * 1.0 - Initial version.
+ *
+ */
+
+#ifndef STATIC_FLOAT_PARALLEL_H_
+#define STATIC_FLOAT_PARALLEL_H_
+
+///////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <type_traits>
+#include <cassert>
+
+#include "static_float.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+namespace static_float {
+
+	namespace parallel {
+
+		/**
+		 * @class thread_pool
+		 * @brief Pool of threads with work stealing.
+		 * Every thread have own queue of tasks, takes newest task from it,
+		 * and when it is empty, steals oldest task from other queues.
+		 * Thread which calls parallel_for() works on tasks as well,
+		 * so pool of 1 thread runs everything in calling thread.
+		 */
+		class thread_pool {
+		private:
+			struct task_queue {
+				std::mutex m;
+				std::deque<std::function<void()>> tasks;
+			};
+
+			/// Queues of workers, and last one of calling threads.
+			std::vector<std::unique_ptr<task_queue>> queues;
+			std::vector<std::thread> workers;
+			std::mutex wake_m;
+			std::condition_variable wake;
+			std::atomic<size_t> pending;
+			bool stop;
+
+			////////////////////////////
+
+		public:
+			/**
+			 * @param threads count of threads, with calling thread
+			 */
+			explicit thread_pool(uint threads = default_threads())
+				: pending(0), stop(false) {
+				const uint n = threads ? threads : 1;
+				for(uint i = 0; i < n; i++){
+					queues.emplace_back(new task_queue);
+				}
+				for(uint i = 0; i + 1 < n; i++){
+					workers.emplace_back(&thread_pool::worker, this, i);
+				}
+			}
+
+			~thread_pool() {
+				{
+					std::lock_guard<std::mutex> l(wake_m);
+					stop = true;
+				}
+				wake.notify_all();
+				for(std::thread& t : workers){
+					t.join();
+				}
+			}
+
+			thread_pool(const thread_pool&) = delete;
+			thread_pool& operator=(const thread_pool&) = delete;
+
+			////////////////////////////
+
+		public:
+			uint size() const {
+				return uint(queues.size());
+			}
+
+			static uint default_threads() {
+				const uint n = std::thread::hardware_concurrency();
+				return n ? n : 1;
+			}
+
+			/**
+			 * Pool with thread per core, created on first use.
+			 */
+			static thread_pool& global() {
+				static thread_pool pool;
+				return pool;
+			}
+
+			/**
+			 * Call f(k) for k in [0, n) and wait for all of them.
+			 */
+			template<typename F>
+			void parallel_for(size_t n, const F& f) {
+				if(size() == 1 || n <= 1){
+					for(size_t k = 0; k < n; k++){
+						f(k);
+					}
+					return;
+				}
+				std::atomic<size_t> left(n);
+				// Counted before push, so that pop never goes below zero.
+				pending += n;
+				for(size_t k = 0; k < n; k++){
+					task_queue& q = *queues[k % size()];
+					std::lock_guard<std::mutex> l(q.m);
+					q.tasks.emplace_back([&f, &left, k]{
+						f(k);
+						left--;
+					});
+				}
+				{
+					// Under lock, so that waiting worker doesn't miss it.
+					std::lock_guard<std::mutex> l(wake_m);
+				}
+				wake.notify_all();
+				while(left > 0){
+					if(!run_one(size() - 1)){
+						std::this_thread::yield();
+					}
+				}
+			}
+
+			////////////////////////////
+
+		private:
+			bool pop(task_queue& q, bool newest, std::function<void()>& t) {
+				std::lock_guard<std::mutex> l(q.m);
+				if(q.tasks.empty()){
+					return false;
+				}
+				if(newest){
+					t = std::move(q.tasks.back());
+					q.tasks.pop_back();
+				}else{
+					t = std::move(q.tasks.front());
+					q.tasks.pop_front();
+				}
+				pending--;
+				return true;
+			}
+
+			/**
+			 * Run task from own queue, or stolen from other queue.
+			 * @return false if there is no task
+			 */
+			bool run_one(uint self) {
+				std::function<void()> t;
+				bool found = pop(*queues[self], true, t);
+				for(uint j = 1; !found && j < size(); j++){
+					found = pop(*queues[(self + j) % size()], false, t);
+				}
+				if(found){
+					t();
+				}
+				return found;
+			}
+
+			void worker(uint self) {
+				for(;;){
+					if(run_one(self)){
+						continue;
+					}
+					std::unique_lock<std::mutex> l(wake_m);
+					wake.wait(l, [this]{
+						return stop || pending > 0;
+					});
+					if(stop){
+						return;
+					}
+				}
+			}
+		};
+
+		////////////////////////////////////
+
+		namespace detail {
+
+			/// Elements per task, same for any count of threads.
+			constexpr size_t chunk_size = 1 << 14;
+
+			inline size_t chunks(size_t n) {
+				return (n + chunk_size - 1)/chunk_size;
+			}
+
+			/**
+			 * Sum of sum_range(begin, end) over chunks of [0, n).
+			 */
+			template<typename R, typename S>
+			R reduce_chunks(size_t n, thread_pool& pool, const S& sum_range) {
+				typedef typename R::num_type nt;
+				std::vector<nt> partial(chunks(n));
+				pool.parallel_for(partial.size(), [&](size_t k){
+					const size_t b = k*chunk_size;
+					const size_t e = b + chunk_size < n ? b + chunk_size : n;
+					partial[k] = sum_range(b, e);
+				});
+				R r;
+				r.num = 0;
+				for(const nt& p : partial){
+					r.num += p;
+				}
+				return r;
+			}
+
+		} // namespace detail
+
+		////////////////////////////////////
+
+		/**
+		 * out[i] = f(in[i]) for n elements.
+		 */
+		template<typename In, typename Out, typename F>
+		void transform(
+			const In* in,
+			Out* out,
+			size_t n,
+			F f,
+			thread_pool& pool = thread_pool::global()
+		) {
+			pool.parallel_for(detail::chunks(n), [&](size_t k){
+				const size_t b = k*detail::chunk_size;
+				const size_t e = b + detail::chunk_size < n
+					? b + detail::chunk_size
+					: n;
+				for(size_t i = b; i < e; i++){
+					out[i] = f(in[i]);
+				}
+			});
+		}
+
+		/**
+		 * Exact sum of n <= N elements.
+		 * Usage: reduce<1 << 20>(x, n).
+		 */
+		template<uint N, typename T>
+		typename rt::sum<T, N>::rt reduce(
+			const T* x,
+			size_t n,
+			thread_pool& pool = thread_pool::global()
+		) {
+			typedef typename rt::sum<T, N>::rt R;
+			typedef typename R::num_type nt;
+			assert(n <= N);
+			return detail::reduce_chunks<R>(n, pool, [x](size_t b, size_t e){
+				nt s = 0;
+				for(size_t i = b; i < e; i++){
+					s += nt(x[i].num);
+				}
+				return s;
+			});
+		}
+
+		/**
+		 * Exact sum of f(x[i]) for n <= N elements.
+		 */
+		template<uint N, typename T, typename F>
+		typename rt::sum<
+			typename std::result_of<F(const T&)>::type,
+			N
+		>::rt transform_reduce(
+			const T* x,
+			size_t n,
+			F f,
+			thread_pool& pool = thread_pool::global()
+		) {
+			typedef typename rt::sum<
+				typename std::result_of<F(const T&)>::type,
+				N
+			>::rt R;
+			typedef typename R::num_type nt;
+			assert(n <= N);
+			return detail::reduce_chunks<R>(n, pool, [x, &f](size_t b, size_t e){
+				nt s = 0;
+				for(size_t i = b; i < e; i++){
+					s += nt(f(x[i]).num);
+				}
+				return s;
+			});
+		}
+
+		/**
+		 * Exact dot product of n <= N pairs, sum of a[i]*b[i].
+		 */
+		template<uint N, typename A, typename B>
+		typename rt::dot<A, B, N>::rt transform_reduce(
+			const A* a,
+			const B* b,
+			size_t n,
+			thread_pool& pool = thread_pool::global()
+		) {
+			typedef typename rt::dot<A, B, N>::rt R;
+			typedef typename R::num_type nt;
+			assert(n <= N);
+			return detail::reduce_chunks<R>(n, pool, [a, b](size_t s, size_t e){
+				nt d = 0;
+				for(size_t i = s; i < e; i++){
+					d += nt(a[i].num)*nt(b[i].num);
+				}
+				return d;
+			});
+		}
+
+		/**
+		 * out[i] = x[0] + ... + x[i] for n <= N elements.
+		 * Sums of chunks are found in parallel,
+		 * and then chunks are scanned in parallel from their offsets.
+		 */
+		template<uint N, typename T>
+		void inclusive_scan(
+			const T* x,
+			typename rt::sum<T, N>::rt* out,
+			size_t n,
+			thread_pool& pool = thread_pool::global()
+		) {
+			typedef typename rt::sum<T, N>::rt R;
+			typedef typename R::num_type nt;
+			assert(n <= N);
+			const size_t c = detail::chunks(n);
+			std::vector<nt> offset(c);
+			pool.parallel_for(c, [&](size_t k){
+				const size_t b = k*detail::chunk_size;
+				const size_t e = b + detail::chunk_size < n
+					? b + detail::chunk_size
+					: n;
+				nt s = 0;
+				for(size_t i = b; i < e; i++){
+					s += nt(x[i].num);
+				}
+				offset[k] = s;
+			});
+			nt s = 0;
+			for(size_t k = 0; k < c; k++){
+				const nt t = offset[k];
+				offset[k] = s;
+				s += t;
+			}
+			pool.parallel_for(c, [&](size_t k){
+				const size_t b = k*detail::chunk_size;
+				const size_t e = b + detail::chunk_size < n
+					? b + detail::chunk_size
+					: n;
+				nt acc = offset[k];
+				for(size_t i = b; i < e; i++){
+					acc += nt(x[i].num);
+					out[i].num = acc;
+				}
+			});
+		}
+
+	} // namespace parallel
+
+	////////////////////////////////////
+
+} // namespace static_float
+
+
+namespace rt {
+
+	/**
+	 * All N elements are summed in single accumulator,
+	 * so sum grow for ceil(log2(N)) bits, same as in dot.
+	 */
+	template<uint B, int E, uint N>
+	struct sum<static_float::sf<B, E>, N> {
+		typedef static_float::sf<B + static_float::detail::ceil_log2(N), E> rt;
+		typedef typename rt::num_type ct;
+	};
+
+	template<uint B, int E, uint N>
+	struct sum<static_float::usf<B, E>, N> {
+		typedef static_float::usf<B + static_float::detail::ceil_log2(N), E> rt;
+		typedef typename rt::num_type ct;
+	};
+
+} // namespace rt
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // STATIC_FLOAT_PARALLEL_H_
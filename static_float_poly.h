@@ -0,0 +1,422 @@
+/**
+ * @file static_float_poly.h
+ * @date Oct 19, 2026
+ *
+ * @author Milos Subotic <milos.subotic.sm@gmail.com>
+ * @license MIT
+ *
+ * @brief Evaluation of polynomials with compile time coefficients,
+ * with precision of every step planned at compile time.
+ *
+ * @version 1.0
+ * Changelog:
+ * 1.0 - Initial version.
+ *
+ */
+
+#ifndef STATIC_FLOAT_POLY_H_
+#define STATIC_FLOAT_POLY_H_
+
+///////////////////////////////////////////////////////////////////////////////
+
+#include <type_traits>
+
+#include "static_float.h"
+#include "static_float_constant.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+namespace static_float {
+
+	namespace detail {
+
+		constexpr long double abs_ld(long double v) {
+			return v < 0 ? -v : v;
+		}
+
+		constexpr long double pow_ld(long double x, uint k) {
+			return k == 0 ? 1 : x*pow_ld(x, k - 1);
+		}
+
+		/**
+		 * @return smallest i with 2^i > a, for a > 0
+		 */
+		constexpr int bits_above(long double a, int i = 0) {
+			return pow2i(i) > a
+				? pow2i(i - 1) > a ? bits_above(a, i - 1) : i
+				: bits_above(a, i + 1);
+		}
+
+		/**
+		 * @return largest i with 2^i <= a, for a > 0
+		 */
+		constexpr int floor_log2_ld(long double a) {
+			return bits_above(a) - 1;
+		}
+
+		/**
+		 * Bound of |c0 + c1*x + ...| for |x| <= x.
+		 */
+		constexpr long double poly_bound(long double) {
+			return 0;
+		}
+
+		template<typename... T>
+		constexpr long double poly_bound(long double x, long double c, T... r) {
+			return abs_ld(c) + x*poly_bound(x, r...);
+		}
+
+		template<uint K, typename... C>
+		struct type_at;
+
+		template<typename H, typename... T>
+		struct type_at<0, H, T...> {
+			typedef H type;
+		};
+
+		template<uint K, typename H, typename... T>
+		struct type_at<K, H, T...> : type_at<K - 1, T...> {
+		};
+
+		/**
+		 * Signed integer of 32 or 64 bits, with at least BITS bits.
+		 */
+		template<uint BITS>
+		struct poly_int {
+			static_assert(BITS <= 64, "Intermediate of polynomial is too wide!");
+			typedef typename std::conditional<
+				BITS <= 32,
+				int32_t,
+				int64_t
+			>::type type;
+		};
+
+		template<typename C>
+		constexpr long double const_ld() {
+			return C::num*pow2i(C::e);
+		}
+
+		/**
+		 * Constant C in units of 2^E, rounded to nearest.
+		 */
+		template<typename C, int E>
+		constexpr int64_t const_at() {
+			return C::e >= E
+				? C::num*(int64_t(1) << (C::e >= E ? C::e - E : 0))
+				: round_ld(C::num*pow2i(C::e - E));
+		}
+
+		/**
+		 * v in units of 2^FROM to units of 2^TO, rounded to nearest.
+		 */
+		template<int FROM, int TO, typename T>
+		T poly_rescale(T v) {
+			return TO > FROM
+				? round_shift<round_nearest, uint(TO > FROM ? TO - FROM : 0)>(v)
+				: T(v << (TO > FROM ? 0 : FROM - TO));
+		}
+
+		/**
+		 * Common plan of evaluation of c0 + c1*x + ... + cn*x^n,
+		 * for x of type X and result Out.
+		 * Every rounding of intermediate is planned so that its error,
+		 * carried to result, is within share of budget 2^(Out::e - 2).
+		 * With final rounding to Out, error of result is within
+		 * 2^(Out::e) of exact value of polynomial.
+		 */
+		template<typename X, typename Out, typename... C>
+		struct poly_plan {
+			static_assert(sizeof...(C) >= 2, "Polynomial must be at least linear!");
+
+			typedef X x_type;
+			typedef Out out_type;
+
+			template<uint K>
+			struct coef {
+				typedef typename type_at<K, C...>::type type;
+			};
+
+			/// Degree.
+			static constexpr uint n = sizeof...(C) - 1;
+			/// Bound of |x|.
+			static constexpr long double xm = pow2i(int(X::b) + X::e);
+			static constexpr long double xm1 = xm > 1 ? xm : 1;
+			/// Bound of sum of |ci*x^i|.
+			static constexpr long double s = poly_bound(xm1, const_ld<C>()...);
+			/// Levels of Estrin tree.
+			static constexpr uint levels = ceil_log2(n + 1);
+			static constexpr long double budget = pow2i(Out::e - 2);
+		};
+
+		/**
+		 * Horner step k, acc_k = acc_(k+1)*x + c_k.
+		 * Product and coefficient are rounded to 2^e,
+		 * and error 2^e times x^k is within budget/n.
+		 */
+		template<typename P, uint K, bool Top = K == P::n>
+		struct horner_step {
+			typedef horner_step<P, K + 1> prev;
+			typedef typename P::template coef<K>::type c;
+			typedef typename P::x_type X;
+
+			static constexpr int pe = prev::e + X::e;
+			static constexpr int planned = floor_log2_ld(
+				P::budget/(P::n*pow_ld(P::xm, K))
+			);
+			/// Exact sum, when it is not finer than planned.
+			static constexpr int e = rt::max(planned, rt::min(pe, c::e));
+			static constexpr long double bound =
+				abs_ld(const_ld<c>()) + prev::bound*P::xm + pow2i(e);
+			static constexpr uint b = uint(bits_above(bound) - e);
+
+			static_assert(prev::b + X::b < 63, "Product of Horner step is too wide!");
+			typedef typename poly_int<
+				uint(rt::max(prev::b + X::b, b)) + 2
+			>::type pt;
+			typedef typename poly_int<b + 1>::type type;
+
+			static type eval(typename X::num_type x) {
+				const pt p = poly_rescale<pe, e>(pt(prev::eval(x))*pt(x));
+				return type(p + pt(const_at<c, e>()));
+			}
+		};
+
+		template<typename P, uint K>
+		struct horner_step<P, K, true> {
+			typedef typename P::template coef<K>::type c;
+
+			static constexpr int e = c::e;
+			static constexpr long double bound = abs_ld(const_ld<c>());
+			static constexpr uint b = c::b;
+
+			typedef typename poly_int<b + 1>::type type;
+
+			static type eval(typename P::x_type::num_type) {
+				return type(c::num);
+			}
+		};
+
+		/**
+		 * Bound of factor by which error of x^(2^l) is carried to result.
+		 * Power is used directly in nodes, with factor at most s,
+		 * and squared to next power, with factor 2*x^(2^l) + 1.
+		 */
+		constexpr long double estrin_gain(
+			long double s,
+			long double xm1,
+			uint l,
+			uint levels
+		) {
+			return l + 1 >= levels
+				? s
+				: s + (2*pow_ld(xm1, 1u << l) + 1)
+					*estrin_gain(s, xm1, l + 1, levels);
+		}
+
+		/**
+		 * Power x^(2^L) of Estrin scheme.
+		 */
+		template<typename P, uint L>
+		struct estrin_power {
+			typedef estrin_power<P, L - 1> prev;
+
+			static constexpr int pe = 2*prev::e;
+			static constexpr int planned = floor_log2_ld(
+				P::budget/(P::n + P::levels)
+					/estrin_gain(P::s, P::xm1, L, P::levels)
+			);
+			static constexpr int e = rt::max(planned, pe);
+			static constexpr long double bound =
+				prev::bound*prev::bound + pow2i(e);
+			static constexpr uint b = uint(bits_above(bound) - e);
+
+			static_assert(2*prev::b < 63, "Power of Estrin scheme is too wide!");
+			typedef typename poly_int<2*prev::b + 2>::type pt;
+			typedef typename poly_int<b + 1>::type type;
+
+			static type eval(typename P::x_type::num_type x) {
+				const pt v = pt(prev::eval(x));
+				return type(poly_rescale<pe, e>(pt(v*v)));
+			}
+		};
+
+		template<typename P>
+		struct estrin_power<P, 0> {
+			typedef typename P::x_type X;
+
+			static constexpr int e = X::e;
+			static constexpr long double bound = P::xm;
+			static constexpr uint b = X::b;
+
+			typedef typename poly_int<b + 1>::type type;
+
+			static type eval(typename X::num_type x) {
+				return type(x);
+			}
+		};
+
+		enum estrin_kind {
+			estrin_leaf,
+			estrin_single,
+			estrin_pair
+		};
+
+		constexpr estrin_kind estrin_node_kind(uint n, uint l, uint j) {
+			return l == 0
+				? estrin_leaf
+				: (2*j + 1) << (l - 1) > n ? estrin_single : estrin_pair;
+		}
+
+		/**
+		 * Node J of level L of Estrin scheme,
+		 * polynomial of coefficients J*2^L to (J + 1)*2^L - 1,
+		 * node<L - 1, 2J> + node<L - 1, 2J + 1>*x^(2^(L - 1)).
+		 * Error of node is carried to result at most xm1^n times.
+		 */
+		template<
+			typename P,
+			uint L,
+			uint J,
+			estrin_kind Kind = estrin_node_kind(P::n, L, J)
+		>
+		struct estrin_node {
+			typedef estrin_node<P, L - 1, 2*J> lo;
+			typedef estrin_node<P, L - 1, 2*J + 1> hi;
+			typedef estrin_power<P, L - 1> pw;
+
+			static constexpr int pe = hi::e + pw::e;
+			static constexpr int planned = floor_log2_ld(
+				P::budget/(P::n + P::levels)/pow_ld(P::xm1, P::n)
+			);
+			static constexpr int e = rt::max(planned, rt::min(pe, lo::e));
+			static constexpr long double bound =
+				lo::bound + hi::bound*pw::bound + pow2i(e);
+			static constexpr uint b = uint(bits_above(bound) - e);
+
+			static_assert(hi::b + pw::b < 63, "Product of Estrin node is too wide!");
+			typedef typename poly_int<
+				uint(rt::max(hi::b + pw::b, b)) + 2
+			>::type pt;
+			typedef typename poly_int<b + 1>::type type;
+
+			static type eval(typename P::x_type::num_type x) {
+				const pt p = poly_rescale<pe, e>(
+					pt(pt(hi::eval(x))*pt(pw::eval(x)))
+				);
+				const pt a = poly_rescale<lo::e, e>(pt(lo::eval(x)));
+				return type(p + a);
+			}
+		};
+
+		template<typename P, uint L, uint J>
+		struct estrin_node<P, L, J, estrin_single>
+			: estrin_node<P, L - 1, 2*J> {
+		};
+
+		template<typename P, uint L, uint J>
+		struct estrin_node<P, L, J, estrin_leaf> {
+			typedef typename P::template coef<J>::type c;
+
+			static constexpr int e = c::e;
+			static constexpr long double bound = abs_ld(const_ld<c>());
+			static constexpr uint b = c::b;
+
+			typedef typename poly_int<b + 1>::type type;
+
+			static type eval(typename P::x_type::num_type) {
+				return type(c::num);
+			}
+		};
+
+		/**
+		 * Result of scheme S rounded to Out.
+		 */
+		template<typename Out, typename S, typename T>
+		Out poly_result(T x) {
+			sf<S::b, S::e> r;
+			r.num = typename sf<S::b, S::e>::num_type(S::eval(x));
+			return requantize<Out>(r);
+		}
+
+		template<typename Out, typename S, typename X>
+		void poly_kernel(const X* __restrict in, Out* __restrict out, size_t n) {
+			for(size_t i = 0; i < n; i++){
+				out[i] = poly_result<Out, S>(in[i].num);
+			}
+		}
+
+	} // namespace detail
+
+	////////////////////////////////////
+
+	/**
+	 * c0 + c1*x + ... + cn*x^n with Horner scheme,
+	 * for coefficients C of type sf_const.
+	 * Intermediates are rounded as much as error allows,
+	 * so result is within 2^(Out::e) of exact value,
+	 * and saturated to range of Out.
+	 * Usage: poly_eval<sf<16, -14>, sf_const<1>, sf_const<1, -1>>(x).
+	 */
+	template<typename Out, typename... C, uint B, int E>
+	Out poly_eval(const sf<B, E>& x) {
+		typedef detail::poly_plan<sf<B, E>, Out, C...> plan;
+		return detail::poly_result<Out, detail::horner_step<plan, 0>>(x.num);
+	}
+
+	template<typename Out, typename... C, uint B, int E>
+	Out poly_eval(const usf<B, E>& x) {
+		typedef detail::poly_plan<usf<B, E>, Out, C...> plan;
+		return detail::poly_result<Out, detail::horner_step<plan, 0>>(x.num);
+	}
+
+	/**
+	 * out[i] = poly_eval<Out, C...>(in[i]) for n arguments.
+	 */
+	template<typename Out, typename... C, typename X>
+	void poly_eval(const X* in, Out* out, size_t n) {
+		typedef detail::poly_plan<X, Out, C...> plan;
+		detail::poly_kernel<Out, detail::horner_step<plan, 0>>(in, out, n);
+	}
+
+	/**
+	 * Same as poly_eval, with Estrin scheme.
+	 * Pairs of terms and powers x^2, x^4, ... are independent,
+	 * so there is more instruction level parallelism than in Horner scheme,
+	 * for few bits more in intermediates.
+	 * Planning of error is coarse for |x| > 1,
+	 * so it is meant for |x| <= 1.
+	 */
+	template<typename Out, typename... C, uint B, int E>
+	Out poly_eval_estrin(const sf<B, E>& x) {
+		typedef detail::poly_plan<sf<B, E>, Out, C...> plan;
+		return detail::poly_result<
+			Out,
+			detail::estrin_node<plan, plan::levels, 0>
+		>(x.num);
+	}
+
+	template<typename Out, typename... C, uint B, int E>
+	Out poly_eval_estrin(const usf<B, E>& x) {
+		typedef detail::poly_plan<usf<B, E>, Out, C...> plan;
+		return detail::poly_result<
+			Out,
+			detail::estrin_node<plan, plan::levels, 0>
+		>(x.num);
+	}
+
+	template<typename Out, typename... C, typename X>
+	void poly_eval_estrin(const X* in, Out* out, size_t n) {
+		typedef detail::poly_plan<X, Out, C...> plan;
+		detail::poly_kernel<
+			Out,
+			detail::estrin_node<plan, plan::levels, 0>
+		>(in, out, n);
+	}
+
+	////////////////////////////////////
+
+} // namespace static_float
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // STATIC_FLOAT_POLY_H_
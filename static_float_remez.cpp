@@ -0,0 +1,571 @@
+/**
+ * @file static_float_remez.cpp
+ * @date Oct 19, 2026
+ *
+ * @author Milos Subotic <milos.subotic.sm@gmail.com>
+ * @license MIT
+ *
+ * @brief Generator of minimax polynomials for poly_eval.
+ * Finds polynomial of lowest degree, with narrowest coefficients,
+ * which approximates function on interval within half LSB of result type,
+ * and prints header with coefficients as sf_const.
+ * Usage:
+ * static_float_remez.elf func lo hi usf|sf B E usf|sf B E [name] > name.h
+ * ie. static_float_remez.elf exp 0 1 usf 16 -16 sf 20 -18 remez_exp
+ *
+ * @version 1.0
+ * Changelog:
+ * 1.0 - Initial version.
+ *
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+#include <string>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <iomanip>
+
+#include <gmpxx.h>
+
+using namespace std;
+
+///////////////////////////////////////////////////////////////////////////////
+
+typedef long double real;
+
+struct func_entry {
+	const char* name;
+	real (*f)(real);
+};
+
+static real recip(real x) {
+	return 1/x;
+}
+
+static real rsqrt(real x) {
+	return 1/sqrtl(x);
+}
+
+static real sigmoid(real x) {
+	return 1/(1 + expl(-x));
+}
+
+static real exp_(real x) { return expl(x); }
+static real exp2_(real x) { return exp2l(x); }
+static real expm1_(real x) { return expm1l(x); }
+static real log_(real x) { return logl(x); }
+static real log2_(real x) { return log2l(x); }
+static real log1p_(real x) { return log1pl(x); }
+static real sin_(real x) { return sinl(x); }
+static real cos_(real x) { return cosl(x); }
+static real tan_(real x) { return tanl(x); }
+static real atan_(real x) { return atanl(x); }
+static real tanh_(real x) { return tanhl(x); }
+static real sqrt_(real x) { return sqrtl(x); }
+static real erf_(real x) { return erfl(x); }
+
+static const func_entry funcs[] = {
+	{"exp", exp_},
+	{"exp2", exp2_},
+	{"expm1", expm1_},
+	{"log", log_},
+	{"log2", log2_},
+	{"log1p", log1p_},
+	{"sin", sin_},
+	{"cos", cos_},
+	{"tan", tan_},
+	{"atan", atan_},
+	{"tanh", tanh_},
+	{"sqrt", sqrt_},
+	{"rsqrt", rsqrt},
+	{"recip", recip},
+	{"sigmoid", sigmoid},
+	{"erf", erf_},
+};
+
+/**
+ * Static float type, sf<b, e> or usf<b, e>.
+ */
+struct type_desc {
+	bool is_signed;
+	int b;
+	int e;
+
+	string str() const {
+		return string(is_signed ? "sf<" : "usf<") + to_string(b)
+			+ ", " + to_string(e) + ">";
+	}
+	real lsb() const {
+		return ldexpl(1, e);
+	}
+	int64_t min_num() const {
+		return is_signed ? -(int64_t(1) << b) : 0;
+	}
+	int64_t max_num() const {
+		return (int64_t(1) << b) - 1;
+	}
+};
+
+/**
+ * Coefficient num*2^e.
+ */
+struct coef_desc {
+	int64_t num;
+	int e;
+
+	real value() const {
+		return ldexpl(real(num), e);
+	}
+};
+
+static const int max_degree = 16;
+/// Arguments, all of input type in interval or evenly chosen ones.
+static const size_t max_grid = 1 << 18;
+static const int max_iters = 50;
+
+///////////////////////////////////////////////////////////////////////////////
+
+static mpf_class to_mpf(real v) {
+	const double hi = double(v);
+	mpf_class r(hi);
+	r += double(v - hi);
+	return r;
+}
+
+static real from_mpf(const mpf_class& m) {
+	const double hi = m.get_d();
+	mpf_class rest = m - hi;
+	return real(hi) + real(rest.get_d());
+}
+
+static real horner(const vector<real>& c, real x) {
+	real p = 0;
+	for(size_t k = c.size(); k-- > 0;){
+		p = p*x + c[k];
+	}
+	return p;
+}
+
+/**
+ * Solve p(x_i) + (-1)^i*E = f(x_i) for coefficients of p and E.
+ * Vandermonde system is ill conditioned, so it is solved with GMP.
+ */
+static void solve_reference(
+	const vector<real>& x,
+	const vector<real>& y,
+	vector<real>& c,
+	real& err
+) {
+	const size_t m = x.size();
+	vector<vector<mpf_class>> a(m, vector<mpf_class>(m + 1));
+	for(size_t i = 0; i < m; i++){
+		mpf_class xi = to_mpf(x[i]);
+		mpf_class p = 1;
+		for(size_t j = 0; j + 1 < m; j++){
+			a[i][j] = p;
+			p *= xi;
+		}
+		a[i][m - 1] = i % 2 ? -1 : 1;
+		a[i][m] = to_mpf(y[i]);
+	}
+	for(size_t k = 0; k < m; k++){
+		size_t piv = k;
+		for(size_t i = k + 1; i < m; i++){
+			if(abs(a[i][k]) > abs(a[piv][k])){
+				piv = i;
+			}
+		}
+		swap(a[k], a[piv]);
+		for(size_t i = k + 1; i < m; i++){
+			mpf_class q = a[i][k]/a[k][k];
+			for(size_t j = k; j <= m; j++){
+				a[i][j] -= q*a[k][j];
+			}
+		}
+	}
+	vector<mpf_class> s(m);
+	for(size_t k = m; k-- > 0;){
+		mpf_class v = a[k][m];
+		for(size_t j = k + 1; j < m; j++){
+			v -= a[k][j]*s[j];
+		}
+		s[k] = v/a[k][k];
+	}
+	c.resize(m - 1);
+	for(size_t j = 0; j + 1 < m; j++){
+		c[j] = from_mpf(s[j]);
+	}
+	err = from_mpf(s[m - 1]);
+}
+
+/**
+ * Remez exchange for polynomial of degree n on points xs.
+ * @return maximal error on xs
+ */
+static real remez(
+	const vector<real>& xs,
+	const vector<real>& ys,
+	int n,
+	vector<real>& c
+) {
+	const size_t m = n + 2;
+	const size_t g = xs.size();
+
+	// Reference at Chebyshev extrema, moved to distinct points.
+	vector<size_t> ref(m);
+	for(size_t j = 0; j < m; j++){
+		real t = (1 - cosl(M_PIl*j/(m - 1)))/2;
+		ref[j] = size_t(llroundl(t*(g - 1)));
+		if(j > 0 && ref[j] <= ref[j - 1]){
+			ref[j] = ref[j - 1] + 1;
+		}
+	}
+	for(size_t j = m; j-- > 0;){
+		size_t top = j + 1 < m ? ref[j + 1] - 1 : g - 1;
+		if(ref[j] > top){
+			ref[j] = top;
+		}
+	}
+
+	real max_err = 0;
+	vector<real> err(g);
+	for(int it = 0; it < max_iters; it++){
+		vector<real> rx(m), ry(m);
+		for(size_t j = 0; j < m; j++){
+			rx[j] = xs[ref[j]];
+			ry[j] = ys[ref[j]];
+		}
+		real level;
+		solve_reference(rx, ry, c, level);
+
+		max_err = 0;
+		for(size_t i = 0; i < g; i++){
+			err[i] = horner(c, xs[i]) - ys[i];
+			max_err = max(max_err, fabsl(err[i]));
+		}
+
+		// Extremum of every run of same sign.
+		vector<size_t> ext;
+		for(size_t i = 0; i < g; i++){
+			bool neg = err[i] < 0;
+			if(ext.empty() || (err[ext.back()] < 0) != neg){
+				ext.push_back(i);
+			}else if(fabsl(err[i]) > fabsl(err[ext.back()])){
+				ext.back() = i;
+			}
+		}
+		if(ext.size() < m){
+			break;
+		}
+		// Drop smallest extrema, inside in pairs, to keep alternation.
+		while(ext.size() > m){
+			size_t k = 0;
+			for(size_t i = 1; i < ext.size(); i++){
+				if(fabsl(err[ext[i]]) < fabsl(err[ext[k]])){
+					k = i;
+				}
+			}
+			if(ext.size() == m + 1){
+				k = fabsl(err[ext.front()]) < fabsl(err[ext.back()])
+					? 0
+					: ext.size() - 1;
+			}
+			if(k == 0 || k + 1 == ext.size()){
+				ext.erase(ext.begin() + k);
+			}else{
+				size_t nb = fabsl(err[ext[k - 1]]) < fabsl(err[ext[k + 1]])
+					? k - 1
+					: k + 1;
+				ext.erase(ext.begin() + max(k, nb));
+				ext.erase(ext.begin() + min(k, nb));
+			}
+		}
+		ref = ext;
+
+		real min_ref = max_err;
+		for(size_t j = 0; j < m; j++){
+			min_ref = min(min_ref, fabsl(err[ref[j]]));
+		}
+		if(max_err - min_ref <= 1e-4L*max_err){
+			break;
+		}
+	}
+	return max_err;
+}
+
+static real max_error(
+	const vector<real>& xs,
+	const vector<real>& ys,
+	const vector<coef_desc>& q
+) {
+	vector<real> c(q.size());
+	for(size_t k = 0; k < q.size(); k++){
+		c[k] = q[k].value();
+	}
+	real e = 0;
+	for(size_t i = 0; i < xs.size(); i++){
+		e = max(e, fabsl(horner(c, xs[i]) - ys[i]));
+	}
+	return e;
+}
+
+static int bit_width(int64_t v) {
+	uint64_t u = v < 0 ? uint64_t(-v) : uint64_t(v);
+	int w = 0;
+	while(u){
+		w++;
+		u >>= 1;
+	}
+	return w;
+}
+
+/**
+ * Coefficient c rounded to 2^e, normalized like sf_const.
+ * Zero is not valid sf_const, so it is replaced with smallest constant.
+ */
+static coef_desc quantize(real c, int e) {
+	coef_desc q = {int64_t(llroundl(ldexpl(c, -e))), e};
+	if(q.num == 0){
+		q.num = c < 0 ? -1 : 1;
+	}
+	while(q.num % 2 == 0){
+		q.num /= 2;
+		q.e++;
+	}
+	return q;
+}
+
+/**
+ * Round coefficients as coarse as possible,
+ * keeping error on xs within target.
+ * @return false if coefficients would need more than 62 bits
+ */
+static bool quantize_coefs(
+	const vector<real>& xs,
+	const vector<real>& ys,
+	const vector<real>& c,
+	real mm_err,
+	real target,
+	vector<coef_desc>& q
+) {
+	const int n = int(c.size()) - 1;
+	real xm = 0;
+	for(size_t i = 0; i < xs.size(); i++){
+		xm = max(xm, fabsl(xs[i]));
+	}
+	if(xm == 0){
+		xm = 1;
+	}
+
+	// Equal share of remaining error to every coefficient.
+	const real share = (target - mm_err)/(n + 1);
+	vector<int> e(n + 1);
+	for(int k = 0; k <= n; k++){
+		e[k] = int(floorl(log2l(2*share/powl(xm, k))));
+	}
+	q.resize(n + 1);
+	for(;;){
+		bool wide = false;
+		for(int k = 0; k <= n; k++){
+			q[k] = quantize(c[k], e[k]);
+			wide |= bit_width(q[k].num) > 62;
+		}
+		if(wide){
+			return false;
+		}
+		if(max_error(xs, ys, q) <= target){
+			break;
+		}
+		for(int k = 0; k <= n; k++){
+			e[k]--;
+		}
+	}
+
+	// Coarsen coefficients one by one while error allows.
+	for(bool changed = true; changed;){
+		changed = false;
+		for(int k = n; k >= 0; k--){
+			coef_desc old = q[k];
+			q[k] = quantize(c[k], e[k] + 1);
+			if(bit_width(q[k].num) < bit_width(old.num)
+					&& max_error(xs, ys, q) <= target){
+				e[k]++;
+				changed = true;
+			}else{
+				q[k] = old;
+			}
+		}
+	}
+	return true;
+}
+
+static void emit_header(
+	ostream& os,
+	const string& name,
+	const string& func,
+	real lo,
+	real hi,
+	const type_desc& in,
+	const type_desc& out,
+	const vector<coef_desc>& q,
+	real err
+) {
+	const int n = int(q.size()) - 1;
+	string guard;
+	for(char ch : name){
+		guard += char(toupper(ch));
+	}
+	guard += "_H_";
+	string list;
+	for(int k = 0; k <= n; k++){
+		list += ", c" + to_string(k);
+	}
+
+	os << "/**\n";
+	os << " * @file " << name << ".h\n";
+	os << " *\n";
+	os << " * @brief Minimax polynomial of " << func << "(x)"
+		<< " on [" << double(lo) << ", " << double(hi) << "].\n";
+	os << " * Generated by static_float_remez.\n";
+	os << " *\n";
+	os << " */\n\n";
+	os << "#ifndef " << guard << "\n";
+	os << "#define " << guard << "\n\n";
+	os << "////////////////////////////////////////"
+		"///////////////////////////////////////\n\n";
+	os << "#include \"static_float_poly.h\"\n\n";
+	os << "////////////////////////////////////////"
+		"///////////////////////////////////////\n\n";
+	os << "namespace static_float {\n\n";
+	os << "\t/**\n";
+	os << "\t * " << func << "(x) for argument " << in.str()
+		<< " and result " << out.str() << ".\n";
+	os << "\t * Polynomial is within " << setprecision(3)
+		<< double(err/out.lsb()) << " LSB of function,\n";
+	os << "\t * so evaluated result is within "
+		<< double(err/out.lsb() + 1) << " LSB.\n";
+	os << "\t */\n";
+	os << "\tstruct " << name << " {\n";
+	os << "\t\ttypedef " << in.str() << " arg_type;\n";
+	os << "\t\ttypedef " << out.str() << " result_type;\n\n";
+	os << "\t\tstatic constexpr uint degree = " << n << ";\n\n";
+	for(int k = 0; k <= n; k++){
+		os << "\t\ttypedef sf_const<" << q[k].num << ", " << q[k].e
+			<< "> c" << k << ";\n";
+	}
+	os << "\n";
+	os << "\t\tstatic result_type eval(const arg_type& x) {\n";
+	os << "\t\t\treturn poly_eval<result_type" << list << ">(x);\n";
+	os << "\t\t}\n\n";
+	os << "\t\tstatic result_type eval_estrin(const arg_type& x) {\n";
+	os << "\t\t\treturn poly_eval_estrin<result_type" << list << ">(x);\n";
+	os << "\t\t}\n\n";
+	os << "\t\tstatic void eval(\n";
+	os << "\t\t\tconst arg_type* in,\n";
+	os << "\t\t\tresult_type* out,\n";
+	os << "\t\t\tsize_t n\n";
+	os << "\t\t) {\n";
+	os << "\t\t\tpoly_eval<result_type" << list << ">(in, out, n);\n";
+	os << "\t\t}\n";
+	os << "\t};\n\n";
+	os << "} // namespace static_float\n\n";
+	os << "////////////////////////////////////////"
+		"///////////////////////////////////////\n\n";
+	os << "#endif // " << guard << "\n";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static bool parse_type(char** argv, type_desc& t) {
+	if(strcmp(argv[0], "sf") && strcmp(argv[0], "usf")){
+		return false;
+	}
+	t.is_signed = strcmp(argv[0], "sf") == 0;
+	t.b = atoi(argv[1]);
+	t.e = atoi(argv[2]);
+	return t.b > 0 && t.b <= 62;
+}
+
+static int usage() {
+	cerr << "Usage: static_float_remez.elf"
+		" func lo hi usf|sf B E usf|sf B E [name]" << endl;
+	cerr << "Functions:";
+	for(const func_entry& f : funcs){
+		cerr << " " << f.name;
+	}
+	cerr << endl;
+	return 1;
+}
+
+int main(int argc, char** argv) {
+	if(argc != 10 && argc != 11){
+		return usage();
+	}
+	const func_entry* fe = nullptr;
+	for(const func_entry& f : funcs){
+		if(strcmp(argv[1], f.name) == 0){
+			fe = &f;
+		}
+	}
+	type_desc in, out;
+	if(!fe || !parse_type(argv + 4, in) || !parse_type(argv + 7, out)){
+		return usage();
+	}
+	const real lo = strtold(argv[2], nullptr);
+	const real hi = strtold(argv[3], nullptr);
+	const string name = argc == 11 ? argv[10] : string("remez_") + fe->name;
+
+	mpf_set_default_prec(256);
+
+	// Arguments of input type in [lo, hi].
+	int64_t k_lo = max(int64_t(ceill(lo/in.lsb())), in.min_num());
+	int64_t k_hi = min(int64_t(floorl(hi/in.lsb())), in.max_num());
+	if(k_hi - k_lo < 1){
+		cerr << "Interval have less than two arguments!" << endl;
+		return 1;
+	}
+	const uint64_t count = uint64_t(k_hi - k_lo) + 1;
+	const size_t g = count < max_grid ? size_t(count) : max_grid;
+	vector<real> xs(g), ys(g);
+	for(size_t i = 0; i < g; i++){
+		int64_t k = k_lo + int64_t(llroundl(real(i)*(count - 1)/(g - 1)));
+		xs[i] = ldexpl(real(k), in.e);
+		ys[i] = fe->f(xs[i]);
+		if(!isfinite(ys[i])){
+			cerr << "Function is not finite at " << double(xs[i]) << endl;
+			return 1;
+		}
+	}
+
+	const real target = out.lsb()/2;
+	for(int n = 1; n <= max_degree && size_t(n) + 2 <= g; n++){
+		vector<real> c;
+		real mm_err = remez(xs, ys, n, c);
+		cerr << "degree " << n << ": minimax error "
+			<< double(mm_err/out.lsb()) << " LSB" << endl;
+		if(mm_err >= target){
+			continue;
+		}
+		vector<coef_desc> q;
+		if(!quantize_coefs(xs, ys, c, mm_err, target, q)){
+			continue;
+		}
+		real err = max_error(xs, ys, q);
+		cerr << "coefficient bits:";
+		for(const coef_desc& d : q){
+			cerr << " " << bit_width(d.num);
+		}
+		cerr << ", error " << double(err/out.lsb()) << " LSB" << endl;
+		emit_header(cout, name, fe->name, lo, hi, in, out, q, err);
+		return 0;
+	}
+	cerr << "No polynomial up to degree " << max_degree
+		<< " is within half LSB!" << endl;
+	return 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,826 @@
+/**
+ * @file static_float_round.h
+ * @date Oct 19, 2026
+ *
+ * @author Milos Subotic <milos.subotic.sm@gmail.com>
+ * @license MIT
+ *
+ * @brief Branchless floor, ceil, trunc, round, fract, modf, sign,
+ * min, max, clamp, mix, step and smoothstep of static floats.
+ *
+ * @version 1.0
+ * Changelog:
+ * 1.0 - Initial version.
+ *
+ */
+
+#ifndef STATIC_FLOAT_ROUND_H_
+#define STATIC_FLOAT_ROUND_H_
+
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <cassert>
+#include <type_traits>
+
+#include "static_float.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+namespace rt {
+
+	/**
+	 * Integers have no fraction bits. Floor and trunc fit in integer bits
+	 * of argument, ceil and round need one bit more, for rounding up of
+	 * largest number. Static float without fraction bits is integer already.
+	 */
+	template<uint B, int E>
+	struct floor<static_float::sf<B, E>> {
+		typedef typename std::conditional<
+			(E >= 0),
+			static_float::sf<B, E>,
+			static_float::sf<uint(max(int(B) + E, 1)), 0>
+		>::type rt;
+	};
+
+	template<uint B, int E>
+	struct trunc<static_float::sf<B, E>> : floor<static_float::sf<B, E>> {
+	};
+
+	template<uint B, int E>
+	struct ceil<static_float::sf<B, E>> {
+		typedef typename std::conditional<
+			(E >= 0),
+			static_float::sf<B, E>,
+			static_float::sf<uint(max(int(B) + E + 1, 1)), 0>
+		>::type rt;
+	};
+
+	template<uint B, int E>
+	struct round<static_float::sf<B, E>> : ceil<static_float::sf<B, E>> {
+	};
+
+	template<uint B, int E>
+	struct floor<static_float::usf<B, E>> {
+		typedef typename std::conditional<
+			(E >= 0),
+			static_float::usf<B, E>,
+			static_float::usf<uint(max(int(B) + E, 1)), 0>
+		>::type rt;
+	};
+
+	template<uint B, int E>
+	struct trunc<static_float::usf<B, E>> : floor<static_float::usf<B, E>> {
+	};
+
+	template<uint B, int E>
+	struct ceil<static_float::usf<B, E>> {
+		typedef typename std::conditional<
+			(E >= 0),
+			static_float::usf<B, E>,
+			static_float::usf<uint(max(int(B) + E + 1, 1)), 0>
+		>::type rt;
+	};
+
+	template<uint B, int E>
+	struct round<static_float::usf<B, E>> : ceil<static_float::usf<B, E>> {
+	};
+
+	/**
+	 * Fraction x - floor(x) is in [0, 1), with all fraction bits of x,
+	 * because negative x is complemented.
+	 */
+	template<uint B, int E>
+	struct fract<static_float::sf<B, E>> {
+		static constexpr uint F = uint(max(-E, 1));
+		typedef static_float::usf<F, -int(F)> rt;
+	};
+
+	/**
+	 * Fraction x - trunc(x) have sign of x and it is not longer than x.
+	 */
+	template<uint B, int E>
+	struct modf<static_float::sf<B, E>> {
+		static constexpr uint F = uint(max(min(-E, int(B)), 1));
+		typedef static_float::sf<F, (E < 0 ? E : -1)> rt;
+	};
+
+	template<uint B, int E>
+	struct modf<static_float::usf<B, E>> {
+		static constexpr uint F = uint(max(min(-E, int(B)), 1));
+		typedef static_float::usf<F, (E < 0 ? E : -1)> rt;
+	};
+
+	template<uint B, int E>
+	struct fract<static_float::usf<B, E>> : modf<static_float::usf<B, E>> {
+	};
+
+	template<uint B, int E>
+	struct sign<static_float::sf<B, E>> {
+		typedef static_float::sf<1, 0> rt;
+	};
+
+	template<uint B, int E>
+	struct sign<static_float::usf<B, E>> {
+		typedef static_float::usf<1, 0> rt;
+	};
+
+	/**
+	 * Like add_sub, but without bit for carry.
+	 */
+	template<uint B1, int E1, uint B2, int E2>
+	struct min_max<static_float::sf<B1, E1>, static_float::sf<B2, E2>> {
+		constexpr static int _min_e = min(E1, E2);
+		constexpr static int _max_bit = max(int(B1) + E1, int(B2) + E2);
+		typedef static_float::sf<_max_bit - _min_e, _min_e> rt;
+		typedef typename rt::num_type ct;
+		constexpr static uint SH1 = E1 - _min_e;
+		constexpr static uint SH2 = E2 - _min_e;
+	};
+
+	template<uint B1, int E1, uint B2, int E2>
+	struct min_max<static_float::usf<B1, E1>, static_float::usf<B2, E2>> {
+		constexpr static int _min_e = min(E1, E2);
+		constexpr static int _max_bit = max(int(B1) + E1, int(B2) + E2);
+		typedef static_float::usf<_max_bit - _min_e, _min_e> rt;
+		typedef typename rt::num_type ct;
+		constexpr static uint SH1 = E1 - _min_e;
+		constexpr static uint SH2 = E2 - _min_e;
+	};
+
+	/**
+	 * x + (y - x)*a is between x and y for a in [0, 1],
+	 * so it have integer bits of x and fraction bits of x and a.
+	 * ct holds x*2^FA and (y - x)*a, and their sum.
+	 */
+	template<uint B, int E, uint BA, int EA>
+	struct mix<static_float::sf<B, E>, static_float::usf<BA, EA>> {
+		static_assert(int(BA) + EA <= 1, "Weight of mix() must be in [0, 1]!");
+		static constexpr uint FA = uint(max(-EA, 0));
+		typedef static_float::sf<B + FA, E - int(FA)> rt;
+		typedef typename static_float::sf<
+			max(B + FA, B + BA + 1) + 2,
+			0
+		>::num_type ct;
+	};
+
+	template<uint B, int E, uint BA, int EA>
+	struct mix<static_float::usf<B, E>, static_float::usf<BA, EA>> {
+		static_assert(int(BA) + EA <= 1, "Weight of mix() must be in [0, 1]!");
+		static constexpr uint FA = uint(max(-EA, 0));
+		typedef static_float::usf<B + FA, E - int(FA)> rt;
+		typedef typename static_float::sf<
+			max(B + FA, B + BA + 1) + 2,
+			0
+		>::num_type ct;
+	};
+
+	/**
+	 * Result in [0, 1], with fraction bits as bits of argument.
+	 */
+	template<uint B, int E>
+	struct smoothstep<static_float::sf<B, E>> {
+		typedef static_float::usf<B + 1, -int(B)> rt;
+		typedef typename static_float::sf<2*B + 3, 0>::num_type ct;
+	};
+
+	template<uint B, int E>
+	struct smoothstep<static_float::usf<B, E>> {
+		typedef static_float::usf<B + 1, -int(B)> rt;
+		typedef typename static_float::sf<2*B + 3, 0>::num_type ct;
+	};
+
+} // namespace rt
+
+
+namespace static_float {
+
+	namespace detail {
+
+		/**
+		 * @return N with F low bits set, without shift into sign bit.
+		 */
+		template<typename N, uint F>
+		N low_mask() {
+			return F == 0
+				? N(0)
+				: N(N(N(1) << (F == 0 ? 0 : F - 1)) - 1)
+					+ N(N(1) << (F == 0 ? 0 : F - 1));
+		}
+
+		/**
+		 * Rounding of num a of static float with B bits and F fraction bits,
+		 * to integer num. Conditions are added as 0 or 1, so there are
+		 * no branches and no overflow of N.
+		 */
+		template<typename N, uint F, uint B, bool Tiny>
+		struct round_num {
+			static N frac(const N& a) {
+				return a & low_mask<N, F>();
+			}
+
+			static N floor(const N& a) {
+				return a >> F;
+			}
+
+			static N ceil(const N& a) {
+				return N(a >> F) + N(frac(a) != 0);
+			}
+
+			static N trunc(const N& a) {
+				return N(a >> F) + N((frac(a) != 0) & (a < 0));
+			}
+
+			/// Halves away from zero.
+			static N round(const N& a) {
+				const N half = N(1) << (F == 0 ? 0 : F - 1);
+				return N(a >> F) + N(frac(a) >= N(half + N(a < 0)));
+			}
+
+			/// a - trunc(a), with sign of a.
+			static N modf(const N& a) {
+				const N r = frac(a);
+				return r - N(N((r != 0) & (a < 0)) << F);
+			}
+		};
+
+		/**
+		 * All B bits of a are fraction, so x is in (-1, 1).
+		 * Shifts are not for F, which could be over width of N.
+		 */
+		template<typename N, uint F, uint B>
+		struct round_num<N, F, B, true> {
+			static N floor(const N& a) {
+				return N(0) - N(a < 0);
+			}
+
+			static N ceil(const N& a) {
+				return N(a > 0);
+			}
+
+			static N trunc(const N&) {
+				return N(0);
+			}
+
+			/**
+			 * Only x of usf<B, -B> could be over half,
+			 * and only lowest x of sf<B, -B-1> is half, ie. -0.5.
+			 */
+			static N round(const N& a) {
+				return N(F == B && N(a >> (B - 1)) != 0)
+					- N(F == B + 1 && a < 0 && (a & low_mask<N, B>()) == 0);
+			}
+
+			static N modf(const N& a) {
+				return a;
+			}
+		};
+
+		/**
+		 * Unsigned num could have exactly B bits,
+		 * so usf<B, -B> is handled as number without integer bits.
+		 */
+		template<typename T, uint F = (T::e < 0 ? uint(-T::e) : 0)>
+		struct round_of : round_num<
+			typename T::num_type,
+			F,
+			T::b,
+			(F > T::b || (F == T::b && !is_signed_type((T*)nullptr)))
+		> {
+		};
+
+		template<typename R, typename N>
+		R with_num(const N& n) {
+			R r;
+			r.num = typename R::num_type(n);
+			return r;
+		}
+
+		/**
+		 * x - floor(x) is F low bits of num, which are in R.
+		 */
+		template<typename R, uint F, typename T>
+		R fract_impl(const T& x) {
+			typedef typename R::num_type rn;
+			R r;
+			r.num = rn(rn(x.num) & low_mask<rn, F>());
+			return r;
+		}
+
+		template<typename R, typename T, typename A>
+		R mix_impl(const T& x, const T& y, const A& a) {
+			typedef rt::mix<T, A> m;
+			typedef typename m::ct ct;
+			const ct d = ct(y.num) - ct(x.num);
+			R r;
+			r.num = typename R::num_type(
+				ct(x.num)*ct(ct(1) << m::FA) + d*ct(a.num)
+			);
+			return r;
+		}
+
+		template<typename T>
+		typename rt::smoothstep<T>::rt smoothstep_impl(
+			const T& e0,
+			const T& e1,
+			const T& x
+		) {
+			typedef rt::smoothstep<T> s;
+			typedef typename s::ct ct;
+			constexpr uint B = T::b;
+			assert(e0.num < e1.num);
+			const ct w = ct(e1.num) - ct(e0.num);
+			ct d = ct(x.num) - ct(e0.num);
+			d = d < 0 ? ct(0) : d;
+			d = d > w ? w : d;
+			// t in [0, 1] with B fraction bits.
+			const ct t = ct(d << B) / w;
+			const ct t2 = ct(t*t) >> B;
+			typename s::rt r;
+			r.num = typename s::rt::num_type(
+				ct(t2*ct(ct(3) << B) - ct(t2*t << 1)) >> B
+			);
+			return r;
+		}
+
+	} // namespace detail
+
+	////////////////////////////////////
+	// Rounding to integer.
+
+	/**
+	 * Round down. Result have no fraction bits.
+	 * Usage: sf<3, 0> i = floor(sf<7, -4>(x)).
+	 */
+	template<uint B, int E>
+	typename rt::floor<sf<B, E>>::rt floor(const sf<B, E>& x) {
+		return detail::with_num<typename rt::floor<sf<B, E>>::rt>(
+			detail::round_of<sf<B, E>>::floor(x.num)
+		);
+	}
+
+	template<uint B, int E>
+	typename rt::floor<usf<B, E>>::rt floor(const usf<B, E>& x) {
+		return detail::with_num<typename rt::floor<usf<B, E>>::rt>(
+			detail::round_of<usf<B, E>>::floor(x.num)
+		);
+	}
+
+	/**
+	 * Round up.
+	 */
+	template<uint B, int E>
+	typename rt::ceil<sf<B, E>>::rt ceil(const sf<B, E>& x) {
+		return detail::with_num<typename rt::ceil<sf<B, E>>::rt>(
+			detail::round_of<sf<B, E>>::ceil(x.num)
+		);
+	}
+
+	template<uint B, int E>
+	typename rt::ceil<usf<B, E>>::rt ceil(const usf<B, E>& x) {
+		return detail::with_num<typename rt::ceil<usf<B, E>>::rt>(
+			detail::round_of<usf<B, E>>::ceil(x.num)
+		);
+	}
+
+	/**
+	 * Round toward zero.
+	 */
+	template<uint B, int E>
+	typename rt::trunc<sf<B, E>>::rt trunc(const sf<B, E>& x) {
+		return detail::with_num<typename rt::trunc<sf<B, E>>::rt>(
+			detail::round_of<sf<B, E>>::trunc(x.num)
+		);
+	}
+
+	template<uint B, int E>
+	typename rt::trunc<usf<B, E>>::rt trunc(const usf<B, E>& x) {
+		return detail::with_num<typename rt::trunc<usf<B, E>>::rt>(
+			detail::round_of<usf<B, E>>::floor(x.num)
+		);
+	}
+
+	/**
+	 * Round to nearest, halves away from zero, as std::round().
+	 * For halves up use requantize<T, round_nearest>().
+	 */
+	template<uint B, int E>
+	typename rt::round<sf<B, E>>::rt round(const sf<B, E>& x) {
+		return detail::with_num<typename rt::round<sf<B, E>>::rt>(
+			detail::round_of<sf<B, E>>::round(x.num)
+		);
+	}
+
+	template<uint B, int E>
+	typename rt::round<usf<B, E>>::rt round(const usf<B, E>& x) {
+		return detail::with_num<typename rt::round<usf<B, E>>::rt>(
+			detail::round_of<usf<B, E>>::round(x.num)
+		);
+	}
+
+	////////////////////////////////////
+	// Fraction.
+
+	/**
+	 * x - floor(x), in [0, 1).
+	 */
+	template<uint B, int E>
+	typename rt::fract<sf<B, E>>::rt fract(const sf<B, E>& x) {
+		return detail::fract_impl<
+			typename rt::fract<sf<B, E>>::rt,
+			(E < 0 ? uint(-E) : 0)
+		>(x);
+	}
+
+	template<uint B, int E>
+	typename rt::fract<usf<B, E>>::rt fract(const usf<B, E>& x) {
+		return detail::fract_impl<
+			typename rt::fract<usf<B, E>>::rt,
+			(E < 0 ? uint(rt::min(-E, int(B))) : 0)
+		>(x);
+	}
+
+	/**
+	 * Split x to trunc(x), stored to ip, and returned fraction,
+	 * both with sign of x, as std::modf().
+	 */
+	template<uint B, int E>
+	typename rt::modf<sf<B, E>>::rt modf(
+		const sf<B, E>& x,
+		typename rt::trunc<sf<B, E>>::rt* ip
+	) {
+		*ip = trunc(x);
+		return detail::with_num<typename rt::modf<sf<B, E>>::rt>(
+			detail::round_of<sf<B, E>>::modf(x.num)
+		);
+	}
+
+	template<uint B, int E>
+	typename rt::modf<usf<B, E>>::rt modf(
+		const usf<B, E>& x,
+		typename rt::trunc<usf<B, E>>::rt* ip
+	) {
+		*ip = trunc(x);
+		return fract(x);
+	}
+
+	/**
+	 * -1, 0 or 1.
+	 */
+	template<uint B, int E>
+	sf<1, 0> sign(const sf<B, E>& x) {
+		sf<1, 0> r;
+		r.num = int8_t(x.num > 0) - int8_t(x.num < 0);
+		return r;
+	}
+
+	template<uint B, int E>
+	usf<1, 0> sign(const usf<B, E>& x) {
+		usf<1, 0> r;
+		r.num = uint8_t(x.num != 0);
+		return r;
+	}
+
+	////////////////////////////////////
+	// Min, max and clamp.
+
+	/*
+	 * Same types are needed also for overloading,
+	 * they are more specialized than std::min() and std::max().
+	 */
+
+	template<uint B, int E>
+	sf<B, E> min(const sf<B, E>& x, const sf<B, E>& y) {
+		sf<B, E> r;
+		r.num = y.num < x.num ? y.num : x.num;
+		return r;
+	}
+
+	template<uint B, int E>
+	sf<B, E> max(const sf<B, E>& x, const sf<B, E>& y) {
+		sf<B, E> r;
+		r.num = x.num < y.num ? y.num : x.num;
+		return r;
+	}
+
+	template<uint B, int E>
+	usf<B, E> min(const usf<B, E>& x, const usf<B, E>& y) {
+		usf<B, E> r;
+		r.num = y.num < x.num ? y.num : x.num;
+		return r;
+	}
+
+	template<uint B, int E>
+	usf<B, E> max(const usf<B, E>& x, const usf<B, E>& y) {
+		usf<B, E> r;
+		r.num = x.num < y.num ? y.num : x.num;
+		return r;
+	}
+
+	/**
+	 * Minimum of different types, in type which holds both.
+	 */
+	template<uint B1, int E1, uint B2, int E2>
+	typename rt::min_max<sf<B1, E1>, sf<B2, E2>>::rt
+	min(const sf<B1, E1>& x, const sf<B2, E2>& y) {
+		typedef rt::min_max<sf<B1, E1>, sf<B2, E2>> m;
+		typedef typename m::ct ct;
+		const ct a = ct(x.num)*ct(ct(1) << m::SH1);
+		const ct b = ct(y.num)*ct(ct(1) << m::SH2);
+		return detail::with_num<typename m::rt>(b < a ? b : a);
+	}
+
+	template<uint B1, int E1, uint B2, int E2>
+	typename rt::min_max<sf<B1, E1>, sf<B2, E2>>::rt
+	max(const sf<B1, E1>& x, const sf<B2, E2>& y) {
+		typedef rt::min_max<sf<B1, E1>, sf<B2, E2>> m;
+		typedef typename m::ct ct;
+		const ct a = ct(x.num)*ct(ct(1) << m::SH1);
+		const ct b = ct(y.num)*ct(ct(1) << m::SH2);
+		return detail::with_num<typename m::rt>(a < b ? b : a);
+	}
+
+	template<uint B1, int E1, uint B2, int E2>
+	typename rt::min_max<usf<B1, E1>, usf<B2, E2>>::rt
+	min(const usf<B1, E1>& x, const usf<B2, E2>& y) {
+		typedef rt::min_max<usf<B1, E1>, usf<B2, E2>> m;
+		typedef typename m::ct ct;
+		const ct a = ct(x.num)*ct(ct(1) << m::SH1);
+		const ct b = ct(y.num)*ct(ct(1) << m::SH2);
+		return detail::with_num<typename m::rt>(b < a ? b : a);
+	}
+
+	template<uint B1, int E1, uint B2, int E2>
+	typename rt::min_max<usf<B1, E1>, usf<B2, E2>>::rt
+	max(const usf<B1, E1>& x, const usf<B2, E2>& y) {
+		typedef rt::min_max<usf<B1, E1>, usf<B2, E2>> m;
+		typedef typename m::ct ct;
+		const ct a = ct(x.num)*ct(ct(1) << m::SH1);
+		const ct b = ct(y.num)*ct(ct(1) << m::SH2);
+		return detail::with_num<typename m::rt>(a < b ? b : a);
+	}
+
+	/**
+	 * min(max(x, lo), hi).
+	 */
+	template<uint B, int E>
+	sf<B, E> clamp(const sf<B, E>& x, const sf<B, E>& lo, const sf<B, E>& hi) {
+		return min(max(x, lo), hi);
+	}
+
+	template<uint B, int E>
+	usf<B, E> clamp(
+		const usf<B, E>& x,
+		const usf<B, E>& lo,
+		const usf<B, E>& hi
+	) {
+		return min(max(x, lo), hi);
+	}
+
+	////////////////////////////////////
+	// Interpolation.
+
+	/**
+	 * Linear interpolation x + (y - x)*a, exact, for a in [0, 1].
+	 * Usage: mix(c0, c1, usf<8, -8>(t)).
+	 */
+	template<uint B, int E, uint BA, int EA>
+	typename rt::mix<sf<B, E>, usf<BA, EA>>::rt mix(
+		const sf<B, E>& x,
+		const sf<B, E>& y,
+		const usf<BA, EA>& a
+	) {
+		return detail::mix_impl<
+			typename rt::mix<sf<B, E>, usf<BA, EA>>::rt
+		>(x, y, a);
+	}
+
+	template<uint B, int E, uint BA, int EA>
+	typename rt::mix<usf<B, E>, usf<BA, EA>>::rt mix(
+		const usf<B, E>& x,
+		const usf<B, E>& y,
+		const usf<BA, EA>& a
+	) {
+		return detail::mix_impl<
+			typename rt::mix<usf<B, E>, usf<BA, EA>>::rt
+		>(x, y, a);
+	}
+
+	/// Same as mix().
+	template<typename T, uint BA, int EA>
+	typename rt::mix<T, usf<BA, EA>>::rt lerp(
+		const T& x,
+		const T& y,
+		const usf<BA, EA>& a
+	) {
+		return mix(x, y, a);
+	}
+
+	/**
+	 * 0 for x < edge, else 1.
+	 */
+	template<uint B, int E>
+	usf<1, 0> step(const sf<B, E>& edge, const sf<B, E>& x) {
+		usf<1, 0> r;
+		r.num = uint8_t(!(x.num < edge.num));
+		return r;
+	}
+
+	template<uint B, int E>
+	usf<1, 0> step(const usf<B, E>& edge, const usf<B, E>& x) {
+		usf<1, 0> r;
+		r.num = uint8_t(!(x.num < edge.num));
+		return r;
+	}
+
+	/**
+	 * Hermite interpolation t*t*(3 - 2*t) of t = (x - e0)/(e1 - e0),
+	 * clamped to [0, 1]. Edges must be e0 < e1.
+	 */
+	template<uint B, int E>
+	typename rt::smoothstep<sf<B, E>>::rt smoothstep(
+		const sf<B, E>& e0,
+		const sf<B, E>& e1,
+		const sf<B, E>& x
+	) {
+		return detail::smoothstep_impl(e0, e1, x);
+	}
+
+	template<uint B, int E>
+	typename rt::smoothstep<usf<B, E>>::rt smoothstep(
+		const usf<B, E>& e0,
+		const usf<B, E>& e1,
+		const usf<B, E>& x
+	) {
+		return detail::smoothstep_impl(e0, e1, x);
+	}
+
+	////////////////////////////////////
+	// Batch versions, which compilers vectorize.
+
+	template<uint B, int E>
+	void floor(
+		const sf<B, E>* __restrict in,
+		typename rt::floor<sf<B, E>>::rt* __restrict out,
+		size_t n
+	) {
+		for(size_t i = 0; i < n; i++){
+			out[i] = floor(in[i]);
+		}
+	}
+
+	template<uint B, int E>
+	void floor(
+		const usf<B, E>* __restrict in,
+		typename rt::floor<usf<B, E>>::rt* __restrict out,
+		size_t n
+	) {
+		for(size_t i = 0; i < n; i++){
+			out[i] = floor(in[i]);
+		}
+	}
+
+	template<uint B, int E>
+	void ceil(
+		const sf<B, E>* __restrict in,
+		typename rt::ceil<sf<B, E>>::rt* __restrict out,
+		size_t n
+	) {
+		for(size_t i = 0; i < n; i++){
+			out[i] = ceil(in[i]);
+		}
+	}
+
+	template<uint B, int E>
+	void ceil(
+		const usf<B, E>* __restrict in,
+		typename rt::ceil<usf<B, E>>::rt* __restrict out,
+		size_t n
+	) {
+		for(size_t i = 0; i < n; i++){
+			out[i] = ceil(in[i]);
+		}
+	}
+
+	template<uint B, int E>
+	void trunc(
+		const sf<B, E>* __restrict in,
+		typename rt::trunc<sf<B, E>>::rt* __restrict out,
+		size_t n
+	) {
+		for(size_t i = 0; i < n; i++){
+			out[i] = trunc(in[i]);
+		}
+	}
+
+	template<uint B, int E>
+	void trunc(
+		const usf<B, E>* __restrict in,
+		typename rt::trunc<usf<B, E>>::rt* __restrict out,
+		size_t n
+	) {
+		for(size_t i = 0; i < n; i++){
+			out[i] = trunc(in[i]);
+		}
+	}
+
+	template<uint B, int E>
+	void round(
+		const sf<B, E>* __restrict in,
+		typename rt::round<sf<B, E>>::rt* __restrict out,
+		size_t n
+	) {
+		for(size_t i = 0; i < n; i++){
+			out[i] = round(in[i]);
+		}
+	}
+
+	template<uint B, int E>
+	void round(
+		const usf<B, E>* __restrict in,
+		typename rt::round<usf<B, E>>::rt* __restrict out,
+		size_t n
+	) {
+		for(size_t i = 0; i < n; i++){
+			out[i] = round(in[i]);
+		}
+	}
+
+	template<uint B, int E>
+	void fract(
+		const sf<B, E>* __restrict in,
+		typename rt::fract<sf<B, E>>::rt* __restrict out,
+		size_t n
+	) {
+		for(size_t i = 0; i < n; i++){
+			out[i] = fract(in[i]);
+		}
+	}
+
+	template<uint B, int E>
+	void fract(
+		const usf<B, E>* __restrict in,
+		typename rt::fract<usf<B, E>>::rt* __restrict out,
+		size_t n
+	) {
+		for(size_t i = 0; i < n; i++){
+			out[i] = fract(in[i]);
+		}
+	}
+
+	template<uint B, int E>
+	void sign(const sf<B, E>* __restrict in, sf<1, 0>* __restrict out, size_t n) {
+		for(size_t i = 0; i < n; i++){
+			out[i] = sign(in[i]);
+		}
+	}
+
+	template<uint B, int E>
+	void clamp(
+		const sf<B, E>* __restrict in,
+		sf<B, E>* __restrict out,
+		size_t n,
+		const sf<B, E>& lo,
+		const sf<B, E>& hi
+	) {
+		for(size_t i = 0; i < n; i++){
+			out[i] = clamp(in[i], lo, hi);
+		}
+	}
+
+	template<uint B, int E>
+	void clamp(
+		const usf<B, E>* __restrict in,
+		usf<B, E>* __restrict out,
+		size_t n,
+		const usf<B, E>& lo,
+		const usf<B, E>& hi
+	) {
+		for(size_t i = 0; i < n; i++){
+			out[i] = clamp(in[i], lo, hi);
+		}
+	}
+
+	/**
+	 * out[i] = mix(x[i], y[i], a[i]).
+	 */
+	template<typename T, uint BA, int EA>
+	void mix(
+		const T* __restrict x,
+		const T* __restrict y,
+		const usf<BA, EA>* __restrict a,
+		typename rt::mix<T, usf<BA, EA>>::rt* __restrict out,
+		size_t n
+	) {
+		for(size_t i = 0; i < n; i++){
+			out[i] = mix(x[i], y[i], a[i]);
+		}
+	}
+
+	////////////////////////////////////
+
+} // namespace static_float
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // STATIC_FLOAT_ROUND_H_
@@ -0,0 +1,183 @@
+/**
+ * @file static_float_span.h
+ * @date Oct 19, 2026
+ *
+ * @author Milos Subotic <milos.subotic.sm@gmail.com>
+ * @license MIT
+ *
+ * @brief Views of integer buffers as arrays of static floats, without copy.
+ *
+ * @version 1.0
+ * Changelog:
+ * 1.0 - Initial version.
+ *
+ */
+
+#ifndef STATIC_FLOAT_SPAN_H_
+#define STATIC_FLOAT_SPAN_H_
+
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <type_traits>
+#include <cassert>
+
+#include "static_float.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+namespace static_float {
+
+	/**
+	 * @class basic_sf_span
+	 * @brief View of n static floats T, ie. sf<B, E> or const usf<B, E>,
+	 * over existing buffer of integers in num format of T.
+	 * Static float is standard-layout class with only member num,
+	 * so it have same size, alignment and representation as num_type,
+	 * and pointer to it is pointer to its num.
+	 * That is checked at compile time, and buffer is used in place.
+	 * data() and size() are arguments of batch kernels,
+	 * ie. log2(in.data(), out.data(), in.size()).
+	 * @param T static float type, const for read only view
+	 */
+	template<typename T>
+	class basic_sf_span {
+	public:
+		typedef T element_type;
+		typedef typename std::remove_const<T>::type value_type;
+		typedef typename value_type::num_type num_type;
+		typedef T* iterator;
+		typedef T& reference;
+
+		static_assert(
+			std::is_standard_layout<value_type>::value,
+			"Static float must be standard-layout to alias its num!"
+		);
+		static_assert(
+			sizeof(value_type) == sizeof(num_type)
+				&& alignof(value_type) == alignof(num_type),
+			"Static float must have layout of its num!"
+		);
+		static_assert(
+			std::is_integral<num_type>::value,
+			"Only integer num_type have buffers to view!"
+		);
+
+		////////////////////////////
+
+	private:
+		T* ptr;
+		size_t n;
+
+		////////////////////////////
+
+	public:
+		basic_sf_span()
+			: ptr(nullptr), n(0) {
+		}
+
+		basic_sf_span(T* data, size_t count)
+			: ptr(data), n(count) {
+		}
+
+		/**
+		 * View of count integers I, same width and signedness as num_type,
+		 * ie. int16_t for sf<15, -15> or uint8_t for usf<8, -8>.
+		 */
+		template<typename I>
+		basic_sf_span(I* data, size_t count)
+			: ptr(reinterpret_cast<T*>(data)), n(count) {
+			typedef typename std::remove_const<I>::type plain;
+			static_assert(
+				std::is_integral<plain>::value
+					&& sizeof(plain) == sizeof(num_type)
+					&& std::is_signed<plain>::value
+						== std::is_signed<num_type>::value,
+				"Buffer must be of integers matching num_type!"
+			);
+			static_assert(
+				std::is_const<T>::value || !std::is_const<I>::value,
+				"View of const buffer must be const!"
+			);
+		}
+
+		/// Mutable view is also read only view.
+		template<typename U>
+		basic_sf_span(
+			const basic_sf_span<U>& s,
+			typename std::enable_if<
+				std::is_same<const U, T>::value
+			>::type* = nullptr
+		)
+			: ptr(s.data()), n(s.size()) {
+		}
+
+		////////////////////////////
+
+	public:
+		T* data() const {
+			return ptr;
+		}
+
+		/// Underlying buffer.
+		typename std::conditional<
+			std::is_const<T>::value,
+			const num_type,
+			num_type
+		>::type* nums() const {
+			return &ptr->num;
+		}
+
+		size_t size() const {
+			return n;
+		}
+
+		bool empty() const {
+			return n == 0;
+		}
+
+		T& operator[](size_t i) const {
+			assert(i < n);
+			return ptr[i];
+		}
+
+		iterator begin() const {
+			return ptr;
+		}
+
+		iterator end() const {
+			return ptr + n;
+		}
+
+		/**
+		 * View of count elements from offset,
+		 * or of all elements to end by default.
+		 */
+		basic_sf_span subspan(size_t offset, size_t count = size_t(-1)) const {
+			assert(offset <= n);
+			return basic_sf_span(
+				ptr + offset,
+				count < n - offset ? count : n - offset
+			);
+		}
+	};
+
+	template<uint B, int E>
+	using sf_span = basic_sf_span<sf<B, E>>;
+
+	template<uint B, int E>
+	using usf_span = basic_sf_span<usf<B, E>>;
+
+	template<uint B, int E>
+	using const_sf_span = basic_sf_span<const sf<B, E>>;
+
+	template<uint B, int E>
+	using const_usf_span = basic_sf_span<const usf<B, E>>;
+
+	////////////////////////////////////
+
+} // namespace static_float
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // STATIC_FLOAT_SPAN_H_
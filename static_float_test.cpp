@@ -17,6 +17,8 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <vector>
+#include <string>
+#include <sstream>
 
 using namespace std;
 
@@ -28,6 +30,27 @@ using namespace std;
 #include "static_float.h"
 #define GLM_SWIZZLE
 #include "static_float_vector_math.h"
+#include "static_float_constant.h"
+#include "static_float_gemm.h"
+#include "static_float_nn.h"
+#include "static_float_fir.h"
+#include "static_float_iir.h"
+#include "static_float_fft.h"
+#include "static_float_complex.h"
+#include "static_float_cordic.h"
+#include "static_float_exp_log.h"
+#include "static_float_lut.h"
+#include "static_float_poly.h"
+#include "static_float_accumulator.h"
+#include "static_float_parallel.h"
+#include "static_float_atomic.h"
+#include "static_float_span.h"
+#include "static_float_file.h"
+#include "static_float_codec.h"
+#include "static_float_decimal.h"
+#include "static_float_round.h"
+#include "static_float_bits.h"
+#include "static_float_block.h"
 
 #include "type_collector.h"
 
@@ -234,6 +257,144 @@ dot(const glm::detail::tvec3<static_float::sf<B1, E1>>& x, const glm::detail::tv
 	return x.x;
 }
 
+/// Compile time function for sf_lut.
+struct softsign_fn {
+	static constexpr double f(double x) {
+		return x/(1 + (x < 0 ? -x : x));
+	}
+};
+
+/// Run time function for sf_lut.
+struct sigmoid_fn {
+	double operator()(double x) const {
+		return 1/(1 + exp(-x));
+	}
+};
+
+/// Step of full range of sf<42, -32> for sf_lut.
+struct step_fn {
+	double operator()(double x) const {
+		return x < 0 ? -1000 : 1000;
+	}
+};
+
+/// Rounding functions of static float x against float.
+template<typename T>
+void test_rounding(const T& x) {
+	using namespace static_float;
+	const float v = float(x);
+	auto ip = trunc(x);
+	const float mf = float(modf(x, &ip));
+	assert(float(floor(x)) == std::floor(v) && float(ceil(x)) == std::ceil(v));
+	assert(float(trunc(x)) == std::trunc(v) && float(round(x)) == std::round(v));
+	assert(float(fract(x)) == v - std::floor(v));
+	assert(float(ip) == std::trunc(v) && mf == v - std::trunc(v));
+	assert(float(sign(x)) == float((v > 0) - (v < 0)));
+}
+
+/// FIR of full scale coefficients and samples against mac.
+template<typename TC, typename TI>
+void test_fir_full_scale() {
+	using namespace static_float;
+	constexpr uint N = 9;
+	typedef typename fir<N, TC, TI>::acc_type acc_t;
+	typedef typename TC::num_type cn;
+	typedef typename TI::num_type xn;
+	TC c[N];
+	for(uint k = 0; k < N; k++){
+		c[k].num = k % 3 ? cn(-(cn(1) << (TC::b - 1))) : cn(-(cn(1) << TC::b));
+	}
+	const size_t n = 40;
+	TI x[n];
+	for(size_t i = 0; i < n; i++){
+		x[i].num = i % 5 ? xn(xn(1) << (TI::b - 1)) : xn(-(xn(1) << TI::b));
+	}
+	acc_t y[n];
+	fir<N, TC, TI>(c).process(x, y, n);
+	for(size_t t = 0; t < n; t++){
+		acc_t acc = 0;
+		for(uint k = 0; k < N && k <= t; k++){
+			mac(acc, c[k], x[t - k]);
+		}
+		assert(y[t].num == acc.num);
+	}
+}
+
+/// Saturating FFT of full scale input at 45 degrees twiddle,
+/// odd bins are 2*sqrt(2)*max and saturate.
+template<typename T>
+void test_fft_full_scale() {
+	using namespace static_float;
+	typedef typename T::num_type n_t;
+	const n_t max = n_t((n_t(1) << (T::b - 1)) - 1 + (n_t(1) << (T::b - 1)));
+	T xr[8], xi[8], yr[8], yi[8];
+	for(uint i = 0; i < 8; i++){
+		xr[i].num = xi[i].num = 0;
+	}
+	xr[1].num = xi[1].num = max;
+	xr[5].num = xi[5].num = n_t(-max - 1);
+	fft<8, T, fft_policy<fft_saturate>> f;
+	f(xr, xi, yr, yi);
+	assert(yr[1].num == max && yi[3].num == -max);
+	assert(yr[5].num <= -max && yi[7].num == max);
+	for(uint k = 0; k < 8; k++){
+		const n_t a = k % 4 == 1 ? yi[k].num : yr[k].num;
+		const n_t b = k % 2 == 0 ? yi[k].num : a;
+		assert(a >= -1 && a <= 1 && b >= -1 && b <= 1);
+	}
+}
+
+/// Biquad of full scale coefficients and samples against exact sums,
+/// for one and for three channels.
+/// Reference is not with operators, since sf<B1 + B2> of product
+/// can't hold (-2^B1)*(-2^B2).
+template<typename TC, typename TX, typename TS>
+void test_biquad_full_scale() {
+	using namespace static_float;
+	typedef biquad<TC, TC, TX, TS> f_t;
+	typedef typename f_t::acc_type acc_t;
+	typedef typename TC::num_type cn;
+	typedef typename TX::num_type xn;
+	const cn cmin = cn(-(cn(1) << TC::b));
+	TC b[3], a[2];
+	b[0].num = b[2].num = cmin;
+	b[1].num = cn(cn(1) << (TC::b - 1));
+	a[0].num = cmin;
+	a[1].num = cn(cn(1) << (TC::b - 2));
+	const uint C = 3;
+	const size_t n = 30;
+	vector<TX> x(n*C);
+	for(size_t i = 0; i < x.size(); i++){
+		x[i].num = i % 4 ? xn(xn(1) << (TX::b - 1)) : xn(-(xn(1) << TX::b));
+	}
+	f_t f1(1, b, a), f3(C, b, a);
+	vector<TS> y1(n*C), y3(n*C);
+	f1.process(x.data(), y1.data(), n*C);
+	f3.process(x.data(), y3.data(), n);
+	auto ref = [&](size_t stride, size_t c, const vector<TS>& y){
+		int64_t x1 = 0, x2 = 0, s1 = 0, s2 = 0;
+		for(size_t t = 0; t < y.size()/stride; t++){
+			const int64_t x0 = x[t*stride + c].num;
+			const int64_t bx = b[0].num*x0 + b[1].num*x1 + b[2].num*x2;
+			const int64_t ay = a[0].num*s1 + a[1].num*s2;
+			acc_t acc;
+			acc.num = bx*(int64_t(1) << f_t::_s::SH1)
+				- ay*(int64_t(1) << f_t::_s::SH2);
+			const int64_t y0 = requantize<TS>(acc).num;
+			assert(y[t*stride + c].num == y0);
+			x2 = x1;
+			x1 = x0;
+			s2 = s1;
+			s1 = y0;
+		}
+	};
+	for(uint c = 0; c < C; c++){
+		ref(C, c, y3);
+	}
+	// Single channel filters all samples as one signal.
+	ref(1, 0, y1);
+}
+
 int main() {
 
 	using namespace static_float;
@@ -922,6 +1083,2153 @@ int main() {
 
 	detail::int_big_t bt = c_100_bits;
 #endif
+	////////////////////////////////////
+	// mul_by() and div_by()
+
+	{
+		sf<7, -4> x = 3.25;
+
+		auto x_mul_5 = mul_by<sf_const<5>>(x);
+		sf_float_assert(x_mul_5, 16.25);
+		assert(x_mul_5.b == 10);
+		assert(x_mul_5.e == -4);
+
+		// Type depends on value, not on declared width.
+		auto x_mul_0_5 = mul_by<sf_const<64, -7>>(x);
+		sf_float_assert(x_mul_0_5, 1.625);
+		assert(x_mul_0_5.b == 7);
+		assert(x_mul_0_5.e == -5);
+
+		auto x_mul_m7 = mul_by<sf_const<-7>>(x);
+		sf_float_assert(x_mul_m7, -22.75);
+		assert(x_mul_m7.b == 10);
+
+		// Not sparse constant.
+		auto x_mul_0_671875 = mul_by<sf_const<43, -6>>(x);
+		sf_float_assert(x_mul_0_671875, 3.25f * 0.671875f);
+
+		usf<8, -4> u = 3.25;
+		auto u_mul_5 = mul_by<sf_const<5>>(u);
+		sf_float_assert(u_mul_5, 16.25);
+		assert(u_mul_5.b == 11);
+
+		// Exhaustive against ordinary division.
+		typedef sf<12, -6> x_t;
+		typedef sf_const<3> c3_t;
+		typedef sf_const<-11, 2> cm44_t;
+		for(int n = -(1 << 12); n < (1 << 12); n++){
+			x_t x(x_t::num_type(n), x_t::num_field);
+
+			auto q3 = div_by<c3_t>(x);
+			auto ref3 = x / c3_t::value();
+			assert(q3.e == ref3.e);
+			assert(q3.num == ref3.num);
+
+			auto qm44 = div_by<cm44_t>(x);
+			auto refm44 = x / cm44_t::value();
+			assert(qm44.e == refm44.e);
+			assert(qm44.num == refm44.num);
+
+			assert(mul_by<cm44_t>(x).num == (x * cm44_t::value()).num);
+		}
+
+		auto x_div_0_5 = div_by<sf_const<1, -1>>(x);
+		sf_float_assert(x_div_0_5, 6.5);
+		assert(x_div_0_5.b == 7);
+
+		typedef usf<30, -20> u_t;
+		for(uint n = 0; n < (1 << 30); n += 4099){
+			u_t u(u_t::num_type(n), u_t::num_field);
+			auto q = div_by<sf_const<1000>>(u);
+			assert(q.num == (uint64_t(n) << 7) / 125);
+		}
+	}
+
+	////////////////////////////////////
+	// dot(), mac() and fma()
+
+	{
+		sf<3, 0> x[5] = { 1, -2, 3, 7, -8 };
+		usf<4, -1> y[5] = { 0.5, 1.0, 7.5, 2.0, 1.5 };
+
+		auto d = dot(x, y);
+		sf_float_assert(d, 0.5 - 2 + 22.5 + 14 - 12);
+		assert(d.b == 3 + 4 + 3);
+		assert(d.e == -1);
+
+		typename rt::dot<sf<3, 0>, usf<4, -1>, 5>::rt acc = 0;
+		for(uint i = 0; i < 5; i++){
+			mac(acc, x[i], y[i]);
+		}
+		assert(acc.num == d.num);
+
+		sf<6, -2> z[64];
+		for(int i = 0; i < 64; i++){
+			z[i].num = -64 + i;
+		}
+		auto zz = dot<64>(z, z);
+		assert(zz.b == 6 + 6 + 6);
+		float zzf = 0;
+		for(int i = 0; i < 64; i++){
+			zzf += float(z[i]) * float(z[i]);
+		}
+		sf_float_assert(zz, zzf);
+
+		vector_math::tvec3<sf<2, 0>> a(0, 1, 2);
+		vector_math::tvec3<sf<3, 0>> b(3, 4, -5);
+		auto dot_m6 = vector_math::dot(a, b);
+		sf_float_assert(dot_m6, -6);
+		assert(dot_m6.b == 7);
+		assert(dot_m6.e == 0);
+
+		// Vectors of 2 and 4, and of unsigned, are summed in one accumulator.
+		vector_math::tvec2<sf<2, 0>> a2(1, -2);
+		vector_math::tvec2<sf<3, 0>> b2(3, 4);
+		auto dot_m5 = vector_math::dot(a2, b2);
+		static_assert(is_same<decltype(dot_m5), sf<6, 0>>::value, "dot2!");
+		sf_float_assert(dot_m5, -5);
+		vector_math::tvec4<usf<2, 0>> ua(0, 1, 2, 3);
+		vector_math::tvec4<usf<2, -1>> ub(1.5, 1.5, 1, 0.5);
+		auto dot_5 = vector_math::dot(ua, ub);
+		static_assert(is_same<decltype(dot_5), usf<6, -1>>::value, "dot4!");
+		sf_float_assert(dot_5, 5);
+		vector_math::tvec3<usf<3, 0>> uc(3, 4, 5);
+		auto dot_14 = vector_math::dot(a, uc);
+		static_assert(is_same<decltype(dot_14), sf<7, 0>>::value, "dot3!");
+		sf_float_assert(dot_14, 14);
+		vector_math::tvec4<sf<2, 0>> a4(1, -1, 2, -2);
+		vector_math::tvec4<usf<3, 0>> u4(1, 2, 3, 4);
+		auto dot_m3 = vector_math::dot(a4, u4);
+		static_assert(is_same<decltype(dot_m3), sf<7, 0>>::value, "dot4!");
+		sf_float_assert(dot_m3, -3);
+
+		auto f = fma(sf<3, 0>(3), sf<3, -2>(-1.25), sf<4, 1>(10));
+		sf_float_assert(f, 6.25);
+		assert(f.b == 8);
+		assert(f.e == -2);
+	}
+
+	////////////////////////////////////
+	// tmat
+
+	{
+		using vector_math::tvec2;
+		using vector_math::tvec3;
+		using vector_math::tvec4;
+		using vector_math::tmat2;
+		using vector_math::tmat3;
+		using vector_math::tmat4;
+
+		tmat3<sf<3, 0>> m3;
+		m3[0] = tvec3<sf<3, 0>>(1, 0, -2);
+		m3[1] = tvec3<sf<3, 0>>(2, 1, 0);
+		m3[2] = tvec3<sf<3, 0>>(0, 7, -8);
+		tvec3<sf<2, -1>> v3(1.5, -2, 0.5);
+
+		auto m3v3 = m3 * v3;
+		sf_float_assert(m3v3.x, 1.5 - 4);
+		sf_float_assert(m3v3.y, -2 + 3.5);
+		sf_float_assert(m3v3.z, -3 - 4);
+		assert(m3v3.x.b == 3 + 2 + 2);
+		assert(m3v3.x.e == -1);
+
+		tmat2<usf<4, 0>> m2;
+		m2[0] = tvec2<usf<4, 0>>(1.0, 2.0);
+		m2[1] = tvec2<usf<4, 0>>(3.0, 15.0);
+		auto m2m2 = m2 * m2;
+		sf_float_assert(m2m2[0].x, 7);
+		sf_float_assert(m2m2[0].y, 32);
+		sf_float_assert(m2m2[1].x, 48);
+		sf_float_assert(m2m2[1].y, 231);
+		assert(m2m2[0].x.b == 9);
+
+		tmat4<sf<3, 0>> m4;
+		m4[0] = tvec4<sf<3, 0>>(1, 0, 0, 0);
+		m4[1] = tvec4<sf<3, 0>>(0, -1, 0, 0);
+		m4[2] = tvec4<sf<3, 0>>(0, 0, 2, 0);
+		m4[3] = tvec4<sf<3, 0>>(3, 4, 5, 1);
+		tvec4<sf<4, -2>> v4(1.25, 2, -3, 1);
+		auto m4v4 = m4 * v4;
+		sf_float_assert(m4v4.x, 4.25);
+		sf_float_assert(m4v4.y, 2);
+		sf_float_assert(m4v4.z, -1);
+		sf_float_assert(m4v4.w, 1);
+
+		tvec3<sf<4, -2>> p[3] = {
+			tvec3<sf<4, -2>>(1.25, 2, -3),
+			tvec3<sf<4, -2>>(-0.75, 0, 3.5),
+			tvec3<sf<4, -2>>(3.75, -4, 0.25)
+		};
+		tvec3<sf<3 + 4 + 2, -2>> tp[3];
+		vector_math::transform_points(m4, p, tp, 3);
+		tvec3<sf<3 + 4 + 2, -2>> t[3];
+		vector_math::transform(m3, p, t, 3);
+		for(uint i = 0; i < 3; i++){
+			auto ref = m4 * tvec4<sf<4, -2>>(p[i].x, p[i].y, p[i].z, 1);
+			assert(tp[i].x.num == ref.x.num);
+			assert(tp[i].y.num == ref.y.num);
+			assert(tp[i].z.num == ref.z.num);
+			auto ref3 = m3 * p[i];
+			assert(t[i].x.num == ref3.x.num);
+			assert(t[i].y.num == ref3.y.num);
+			assert(t[i].z.num == ref3.z.num);
+		}
+	}
+
+	////////////////////////////////////
+	// requantize()
+
+	{
+		typedef sf<8, -4> x_t;
+		typedef sf<3, -1> y_t;
+
+		x_t x = -2.6875;
+		sf_float_assert((requantize<y_t>(x)), -2.5);
+		sf_float_assert((requantize<y_t, round_floor>(x)), -3);
+		sf_float_assert((requantize<y_t, round_zero>(x)), -2.5);
+
+		x = 2.75;
+		sf_float_assert((requantize<y_t, round_nearest>(x)), 3);
+		sf_float_assert((requantize<y_t, round_nearest_even>(x)), 3);
+		x = 2.25;
+		sf_float_assert((requantize<y_t, round_nearest>(x)), 2.5);
+		sf_float_assert((requantize<y_t, round_nearest_even>(x)), 2);
+
+		// Saturation.
+		x = 15.5;
+		sf_float_assert((requantize<y_t>(x)), 3.5);
+		x = -15.5;
+		sf_float_assert((requantize<y_t>(x)), -4);
+		sf_float_assert((requantize<usf<3, -1>>(x)), 0);
+
+		// To more fraction bits.
+		sf_float_assert((requantize<sf<12, -8>>(x)), -15.5);
+		sf_float_assert((requantize<sf<10, -8>>(x)), -4);
+	}
+
+	////////////////////////////////////
+	// gemm()
+
+	{
+		typedef sf<7, -7> a_t;
+		typedef usf<8, -8> b_t;
+		constexpr uint K = 33;
+		typedef rt::dot<a_t, b_t, K>::rt acc_t;
+		typedef sf<11, -8> c_t;
+#ifdef __AVX2__
+		static_assert(
+			detail::gemm_kernel<K, a_t, b_t>::madd16,
+			"AVX2 kernel is not tested!"
+		);
+#endif
+
+		const size_t m = 37;
+		const size_t n = 45;
+		vector<a_t> a(m*K);
+		vector<b_t> b(K*n);
+		for(size_t i = 0; i < a.size(); i++){
+			a[i].num = int8_t(i*37 + 11);
+		}
+		for(size_t i = 0; i < b.size(); i++){
+			b[i].num = uint8_t(i*101 + 7);
+		}
+
+		for(uint threads = 1; threads <= 3; threads++){
+			vector<acc_t> c_acc(m*n);
+			vector<c_t> c(m*n);
+			gemm<K>(m, n, a.data(), K, b.data(), n, c_acc.data(), n, threads);
+			gemm<K>(m, n, a.data(), K, b.data(), n, c.data(), n, threads);
+			for(size_t i = 0; i < m; i++){
+				for(size_t j = 0; j < n; j++){
+					acc_t ref = 0;
+					for(uint k = 0; k < K; k++){
+						mac(ref, a[i*K + k], b[k*n + j]);
+					}
+					assert(c_acc[i*n + j].num == ref.num);
+					assert(c[i*n + j].num == requantize<c_t>(ref).num);
+				}
+			}
+		}
+	}
+
+	////////////////////////////////////
+	// nn
+
+	{
+		using namespace nn;
+
+		typedef usf<8, -8> in_t;
+		typedef sf<7, -7> w_t;
+		typedef sf<15, -15> bias_t;
+		typedef usf<8, -6> out_t;
+
+		const uint CI = 3;
+		const uint CO = 5;
+		tensor<in_t> in(CI, 9, 7);
+		for(size_t i = 0; i < in.size(); i++){
+			in.data[i].num = uint8_t(i*53 + 3);
+		}
+		vector<w_t> w(CO*CI*3*3);
+		for(size_t i = 0; i < w.size(); i++){
+			w[i].num = int8_t(i*29 + 5);
+		}
+		vector<bias_t> bias(CO);
+		for(uint i = 0; i < CO; i++){
+			bias[i] = 0.25*i - 0.5;
+		}
+
+		// Reference with mac() and explicit padding.
+		typedef rt::dot<w_t, in_t, CI*3*3>::rt acc_t;
+		for(uint stride = 1; stride <= 2; stride++){
+			tensor<out_t> out(CO, out_size(9, 3, stride), out_size(7, 3, stride));
+			conv2d<3, 3, CI>(in, w.data(), bias.data(), out, stride, 2);
+			for(uint co = 0; co < CO; co++){
+				for(uint y = 0; y < out.h; y++){
+					for(uint x = 0; x < out.w; x++){
+						acc_t acc = 0;
+						for(uint ci = 0; ci < CI; ci++){
+							for(int ky = 0; ky < 3; ky++){
+								for(int kx = 0; kx < 3; kx++){
+									int iy = int(y*stride) + ky - 1;
+									int ix = int(x*stride) + kx - 1;
+									if(iy < 0 || iy >= 9 || ix < 0 || ix >= 7){
+										continue;
+									}
+									mac(acc, w[((co*CI + ci)*3 + ky)*3 + kx],
+											in(ci, iy, ix));
+								}
+							}
+						}
+						assert(out(co, y, x).num ==
+								requantize<out_t>(acc + bias[co]).num);
+					}
+				}
+			}
+		}
+
+		// Depthwise must match conv2d with one input channel.
+		tensor<sf<9, -6>> dw(CI, 9, 7);
+		depthwise_conv2d<3, 3>(in, w.data(), bias.data(), dw, 1, 2);
+		for(uint ch = 0; ch < CI; ch++){
+			tensor<in_t> in1(1, 9, 7);
+			copy(in.channel(ch), in.channel(ch) + 9*7, in1.data.begin());
+			tensor<sf<9, -6>> ref(1, 9, 7);
+			conv2d<3, 3, 1>(in1, w.data() + ch*9, bias.data() + ch, ref);
+			for(uint i = 0; i < 9*7; i++){
+				assert(dw.channel(ch)[i].num == ref.data[i].num);
+			}
+		}
+
+		// Fully connected.
+		vector<out_t> fc(CO);
+		fully_connected<CI*3*3>(in.data.data(), w.data(), bias.data(),
+				fc.data(), CO, 2);
+		for(uint i = 0; i < CO; i++){
+			acc_t acc = dot<CI*3*3>(w.data() + i*CI*3*3, in.data.data());
+			assert(fc[i].num == requantize<out_t>(acc + bias[i]).num);
+		}
+
+		// Activations.
+		tensor<usf<9, -6>> r(CI, 9, 7);
+		relu(dw, r);
+		for(size_t i = 0; i < r.size(); i++){
+			assert(r.data[i].num == max(0, int(dw.data[i].num)));
+		}
+		clamp(dw, sf<9, -6>(-1), sf<9, -6>(1));
+		for(size_t i = 0; i < dw.size(); i++){
+			assert(float(dw.data[i]) >= -1 && float(dw.data[i]) <= 1);
+		}
+
+		auto sigmoid = sigmoid_lut<sf<9, -6>, usf<8, -8>>();
+		sf_float_assert(sigmoid(sf<9, -6>(0)), 0.5);
+		sf_float_assert(sigmoid(sf<9, -6>(-8)), 0);
+		sf_float_assert(sigmoid(sf<9, -6>(7.9)), 1 - 1.0/256);
+		auto th = tanh_lut<sf<9, -6>, sf<7, -7>>();
+		sf_float_assert(th(sf<9, -6>(0)), 0);
+		sf_float_assert(th(sf<9, -6>(-8)), -1);
+		sf_float_assert(th(sf<9, -6>(1)), round(tanh(1.0)*128)/128);
+	}
+
+	////////////////////////////////////
+	// fir
+
+	{
+		typedef sf<15, -15> x_t;
+		typedef sf<11, -12> c_t;
+		typedef sf<15, -15> y_t;
+		// Accumulator is int64, so SIMD kernel is used where available.
+		constexpr uint N = 37;
+		typedef fir<N, c_t, x_t>::acc_type acc_t;
+#ifdef __AVX2__
+		static_assert(
+			detail::fir_types<c_t, x_t, N>::madd16,
+			"AVX2 kernel is not tested!"
+		);
+#endif
+
+		c_t c[N];
+		for(uint k = 0; k < N; k++){
+			c[k].num = int16_t(k*613 + 97) >> 4;
+		}
+		const size_t n = 300;
+		vector<x_t> x(n);
+		for(size_t i = 0; i < n; i++){
+			x[i].num = int16_t(i*40503 + 11);
+		}
+
+		// Reference.
+		vector<y_t> ref(n);
+		for(size_t t = 0; t < n; t++){
+			acc_t acc = 0;
+			for(uint k = 0; k < N && k <= t; k++){
+				mac(acc, c[k], x[t - k]);
+			}
+			ref[t] = requantize<y_t>(acc);
+		}
+
+		// Streaming in uneven chunks.
+		fir<N, c_t, x_t> f(c);
+		vector<y_t> y(n);
+		for(size_t i = 0, chunk = 1; i < n; i += chunk, chunk = chunk*3 % 31){
+			size_t m = min(chunk, n - i);
+			f.process(x.data() + i, y.data() + i, m);
+		}
+		for(size_t t = 0; t < n; t++){
+			assert(y[t].num == ref[t].num);
+		}
+
+		// Decimation by 3 keeps every 3rd output of full filter.
+		fir_decimator<N, 3, c_t, x_t> dec(c);
+		vector<y_t> yd(n);
+		size_t nd = 0;
+		for(size_t i = 0; i < n; i += 7){
+			nd += dec.process(x.data() + i, yd.data() + nd, min<size_t>(7, n - i));
+		}
+		assert(nd >= n/3 - N/3 - 1);
+		for(size_t j = 0; j < nd; j++){
+			assert(yd[j].num == ref[j*3].num);
+		}
+
+		// Interpolation by 4 is full filter on zero stuffed input.
+		vector<x_t> xs(4*n, x_t(0));
+		for(size_t i = 0; i < n; i++){
+			xs[4*i] = x[i];
+		}
+		vector<y_t> ys_ref(4*n);
+		fir<N, c_t, x_t>(c).process(xs.data(), ys_ref.data(), 4*n);
+		fir_interpolator<N, 4, c_t, x_t> interp(c);
+		vector<y_t> ys(4*n);
+		interp.process(x.data(), ys.data(), 100);
+		interp.process(x.data() + 100, ys.data() + 400, n - 100);
+		for(size_t i = 0; i < 4*n; i++){
+			assert(ys[i].num == ys_ref[i].num);
+		}
+
+		// Product of B1 + B2 = 7, 15 and 31 bits have no headroom in
+		// int8, int16 and int32, so it is summed in wider type.
+		test_fir_full_scale<sf<8, -8>, sf<7, -7>>();
+		test_fir_full_scale<sf<16, -16>, sf<15, -15>>();
+		test_fir_full_scale<sf<15, -15>, sf<16, -16>>();
+		test_fir_full_scale<sf<20, -20>, sf<11, -11>>();
+	}
+
+	////////////////////////////////////
+	// iir
+
+	{
+		typedef sf<15, -14> coef_t;
+		typedef sf<15, -15> x_t;
+		typedef sf<15, -15> s1_t;
+		typedef sf<17, -15> s2_t;
+		typedef biquad<coef_t, coef_t, x_t, s1_t> stage1_t;
+		typedef biquad<coef_t, coef_t, s1_t, s2_t, round_floor> stage2_t;
+
+		// Low pass sections.
+		coef_t b1[3] = {0.0675, 0.135, 0.0675};
+		coef_t a1[2] = {-1.143, 0.4128};
+		coef_t b2[3] = {0.25, 0.5, 0.25};
+		coef_t a2[2] = {-0.5, 0.1};
+
+		const uint C = 5;
+		const size_t n = 200;
+		vector<x_t> x(n*C);
+		for(size_t i = 0; i < x.size(); i++){
+			x[i].num = int16_t(i*7919 + 13);
+		}
+
+		iir_cascade<stage1_t, stage2_t> f(
+			stage1_t(C, b1, a1),
+			stage2_t(C, b2, a2)
+		);
+		vector<s2_t> y(n*C);
+		f.process(x.data(), y.data(), 77);
+		f.process(x.data() + 77*C, y.data() + 77*C, n - 77);
+
+		// Reference with operators, channel by channel.
+		for(uint c = 0; c < C; c++){
+			x_t x1 = 0, x2 = 0;
+			s1_t u1 = 0, u2 = 0;
+			s2_t y1 = 0, y2 = 0;
+			for(size_t t = 0; t < n; t++){
+				x_t x0 = x[t*C + c];
+				s1_t u0 = requantize<s1_t>(
+					b1[0]*x0 + b1[1]*x1 + b1[2]*x2 - (a1[0]*u1 + a1[1]*u2)
+				);
+				s2_t y0 = requantize<s2_t, round_floor>(
+					b2[0]*u0 + b2[1]*u1 + b2[2]*u2 - (a2[0]*y1 + a2[1]*y2)
+				);
+				assert(y[t*C + c].num == y0.num);
+				x2 = x1;
+				x1 = x0;
+				u2 = u1;
+				u1 = u0;
+				y2 = y1;
+				y1 = y0;
+			}
+		}
+
+		// Single channel is filtered without vectorization.
+		iir_cascade<stage1_t, stage2_t> f1(
+			stage1_t(1, b1, a1),
+			stage2_t(1, b2, a2)
+		);
+		vector<x_t> x_ch(n);
+		vector<s2_t> y_ch(n);
+		for(size_t t = 0; t < n; t++){
+			x_ch[t] = x[t*C + 3];
+		}
+		f1.process(x_ch.data(), y_ch.data(), n);
+		for(size_t t = 0; t < n; t++){
+			assert(y_ch[t].num == y[t*C + 3].num);
+		}
+
+		// Products of B1 + B2 = 31 bits have no headroom in int32.
+		test_biquad_full_scale<sf<16, -14>, sf<15, -15>, sf<20, -16>>();
+		test_biquad_full_scale<sf<8, -6>, sf<7, -7>, sf<12, -8>>();
+
+		// State saturates on unstable filter.
+		coef_t b3[3] = {1, 0, 0};
+		coef_t a3[2] = {-1.99, 0.999};
+		biquad<coef_t, coef_t, x_t, s1_t> g(1, b3, a3);
+		vector<x_t> step(50, x_t(0.5));
+		vector<s1_t> ys(50);
+		g.process(step.data(), ys.data(), 50);
+		s1_t max_s;
+		max_s.num = 32767;
+		assert(find(ys.begin(), ys.end(), max_s) != ys.end());
+	}
+
+	////////////////////////////////////
+	// fft
+
+	{
+		typedef sf<15, -15> x_t;
+		const uint N = 256;
+
+		vector<x_t> xr(N), xi(N);
+		vector<double> dr(N), di(N);
+		for(uint i = 0; i < N; i++){
+			xr[i].num = int16_t(i*40503 + 7) >> 1;
+			xi[i].num = int16_t(i*7919 + 3) >> 1;
+			dr[i] = double(xr[i]);
+			di[i] = double(xi[i]);
+		}
+		vector<double> Xr(N), Xi(N);
+		for(uint k = 0; k < N; k++){
+			for(uint n = 0; n < N; n++){
+				double a = -6.283185307179586*((k*n) % N)/N;
+				Xr[k] += dr[n]*cos(a) - di[n]*sin(a);
+				Xi[k] += dr[n]*sin(a) + di[n]*cos(a);
+			}
+		}
+		auto snr = [&](const double* yr, const double* yi) {
+			double sig = 0;
+			double noise = 0;
+			for(uint k = 0; k < N; k++){
+				sig += Xr[k]*Xr[k] + Xi[k]*Xi[k];
+				noise += (yr[k] - Xr[k])*(yr[k] - Xr[k])
+					+ (yi[k] - Xi[k])*(yi[k] - Xi[k]);
+			}
+			return 10*log10(sig/noise);
+		};
+
+		{
+			typedef fft<N, x_t> f_t;
+			static_assert(
+				is_same<f_t::out_type, sf<23, -15>>::value,
+				"Growing FFT type!"
+			);
+			f_t f;
+			vector<f_t::out_type> yr(N), yi(N);
+			f(xr.data(), xi.data(), yr.data(), yi.data());
+			vector<double> ydr(N), ydi(N);
+			for(uint k = 0; k < N; k++){
+				ydr[k] = double(yr[k]);
+				ydi[k] = double(yi[k]);
+			}
+			assert(snr(ydr.data(), ydi.data()) > 80);
+		}
+		{
+			typedef fft<N, x_t, fft_policy<fft_halve>> f_t;
+			static_assert(
+				is_same<f_t::out_type, sf<15, -7>>::value,
+				"Halving FFT type!"
+			);
+			f_t f;
+			vector<f_t::out_type> yr(N), yi(N);
+			f(xr.data(), xi.data(), yr.data(), yi.data());
+			vector<double> ydr(N), ydi(N);
+			for(uint k = 0; k < N; k++){
+				ydr[k] = double(yr[k]);
+				ydi[k] = double(yi[k]);
+			}
+			assert(snr(ydr.data(), ydi.data()) > 50);
+		}
+		{
+			// Inverse of grown transform returns N times input.
+			typedef fft<N, x_t, fft_policy_grow_then_halve<4>> f_t;
+			f_t f;
+			vector<f_t::out_type> yr(N), yi(N);
+			f(xr.data(), xi.data(), yr.data(), yi.data());
+			typedef fft<N, f_t::out_type, fft_policy<fft_grow>> g_t;
+			g_t g(true);
+			vector<g_t::out_type> zr(N), zi(N);
+			g(yr.data(), yi.data(), zr.data(), zi.data());
+			for(uint i = 0; i < N; i++){
+				assert(fabs(double(zr[i])/N - dr[i]) < 1e-2);
+				assert(fabs(double(zi[i])/N - di[i]) < 1e-2);
+			}
+		}
+
+		test_fft_full_scale<sf<15, -15>>();
+		test_fft_full_scale<sf<16, -16>>();
+		test_fft_full_scale<sf<31, -31>>();
+	}
+
+	////////////////////////////////////
+	// csf
+
+	{
+		typedef csf<7, -6> c1_t;
+		typedef csf<9, -8> c2_t;
+		c1_t a(0.5, -1.25);
+		c2_t b(1.5, 0.75);
+
+		auto s = a + b;
+		static_assert(is_same<decltype(s), csf<10, -8>>::value, "csf add!");
+		sf_float_assert(s.re, 2);
+		sf_float_assert(s.im, -0.5);
+		auto d = a - b;
+		sf_float_assert(d.re, -1);
+		sf_float_assert(d.im, -2);
+
+		auto p = a*b;
+		static_assert(is_same<decltype(p), csf<17, -14>>::value, "csf mul!");
+		sf_float_assert(p.re, 0.5*1.5 + 1.25*0.75);
+		sf_float_assert(p.im, 0.5*0.75 - 1.25*1.5);
+
+		auto q = a*sf<3, -1>(2.5);
+		sf_float_assert(q.re, 1.25);
+		sf_float_assert(q.im, -3.125);
+
+		c1_t c = conj(a);
+		sf_float_assert(c.im, 1.25);
+		auto n = norm(a);
+		static_assert(is_same<decltype(n), usf<15, -12>>::value, "csf norm!");
+		sf_float_assert(n, 0.25 + 1.5625);
+
+		// Both forms are exact, for narrow, 128 bit and big parts.
+		for(int i = 0; i < 200; i++){
+			c1_t x;
+			c2_t y;
+			x.re.num = int8_t(i*37 + 5);
+			x.im.num = int8_t(i*91 + 1);
+			y.re.num = int16_t(i*1237 + 3) >> 6;
+			y.im.num = int16_t(i*4079 + 7) >> 6;
+			assert(mul3(x, y) == mul4(x, y));
+			assert(mul3(x, x) == mul4(x, x));
+
+			csf<60, -30> u(x), v(y);
+			assert(mul3(u, v) == mul4(u, v));
+			csf<100, -50> w(x), z(y);
+			assert(mul3(w, z) == mul4(w, z));
+		}
+		static_assert(!rt::mul<c1_t, c2_t>::mul3, "4-mult for narrow parts!");
+		static_assert(
+			!rt::mul<csf<60, -30>, csf<60, -30>>::mul3,
+			"4-mult for 128 bit parts!"
+		);
+		static_assert(
+			rt::mul<csf<100, -50>, csf<100, -50>>::mul3,
+			"3-mult for big parts!"
+		);
+		static_assert(
+			rt::mul<csf<1000, -500>, csf<1000, -500>>::mul3,
+			"3-mult for wide big parts!"
+		);
+		{
+			csf<1000, -500> u(1.5, -0.25), v(-3.0, 0.75);
+			u.re.num <<= 400;
+			v.im.num *= 12345;
+			// Compared by nums, since float of parts overflows.
+			auto p3 = mul3(u, v);
+			auto p4 = mul4(u, v);
+			auto p = u*v;
+			assert(p3.re.num == p4.re.num && p3.im.num == p4.im.num);
+			assert(p.re.num == p4.re.num && p.im.num == p4.im.num);
+		}
+
+		// SoA mac against scalar mac.
+		const size_t N = 50;
+		csf_array<c1_t> xs(N);
+		csf_array<c2_t> ys(N);
+		csf_array<csf<20, -14>> acc(N);
+		vector<csf<20, -14>> ref(N, csf<20, -14>(0.0));
+		for(size_t i = 0; i < N; i++){
+			xs.re[i].num = int8_t(i*37 + 5);
+			xs.im[i].num = int8_t(i*91 + 1);
+			ys.re[i].num = int16_t(i*1237 + 3) >> 6;
+			ys.im[i].num = int16_t(i*4079 + 7) >> 6;
+			acc.set(i, ref[i]);
+		}
+		for(int r = 0; r < 3; r++){
+			mac(acc, xs, ys);
+			for(size_t i = 0; i < N; i++){
+				mac(ref[i], xs.get(i), ys.get(i));
+			}
+		}
+		for(size_t i = 0; i < N; i++){
+			assert(acc.get(i) == ref[i]);
+		}
+	}
+
+	////////////////////////////////////
+	// CORDIC
+
+	{
+		typedef sf<15, -12> a_t;
+		typedef sf<15, -14> u_t;
+		const double lsb = ldexp(1.0, -14);
+
+		// Error against double for angles in [-8, 8).
+		double max_s = 0, max_c = 0;
+		vector<a_t> th(1 << 16);
+		for(int i = 0; i < (1 << 16); i++){
+			th[i].num = int16_t(i - (1 << 15));
+			u_t s, c;
+			sincos(th[i], s, c);
+			double t = double(th[i]);
+			max_s = max(max_s, fabs(double(s) - sin(t)));
+			max_c = max(max_c, fabs(double(c) - cos(t)));
+			assert(sin(th[i]) == s && cos(th[i]) == c);
+		}
+		assert(max_s < 2*lsb && max_c < 2*lsb);
+
+		// Batch is bit exact with scalar.
+		vector<u_t> bs(th.size()), bc(th.size());
+		sincos(th.data(), bs.data(), bc.data(), th.size());
+		for(size_t i = 0; i < th.size(); i++){
+			u_t s, c;
+			sincos(th[i], s, c);
+			assert(bs[i] == s && bc[i] == c);
+		}
+
+		// Wide type.
+		typedef sf<28, -24> w_t;
+		double max_w = 0;
+		for(int i = -100; i < 100; i++){
+			w_t t(i*0.0789);
+			auto s = sin(t);
+			double e = ldexp(double(s.num), s.e) - sin(ldexp(double(t.num), t.e));
+			max_w = max(max_w, fabs(e));
+		}
+		assert(max_w < ldexp(1.0, -26));
+
+		// atan2 and hypot in all quadrants.
+		typedef sf<15, -8> v_t;
+		double max_a = 0, max_h = 0;
+		for(int i = -40; i <= 40; i++){
+			for(int j = -40; j <= 40; j++){
+				if(i == 0 && j == 0){
+					continue;
+				}
+				v_t x(i*2.9), y(j*3.1);
+				auto a = atan2(y, x);
+				static_assert(is_same<decltype(a), sf<15, -13>>::value, "atan2!");
+				auto h = hypot(x, y);
+				static_assert(is_same<decltype(h), usf<16, -8>>::value, "hypot!");
+				double ad = atan2(double(y), double(x));
+				double hd = hypot(double(x), double(y));
+				max_a = max(max_a, fabs(double(a) - ad));
+				max_h = max(max_h, fabs(double(h) - hd));
+			}
+		}
+		assert(max_a < 2*ldexp(1.0, -13));
+		assert(max_h < 2*ldexp(1.0, -8));
+
+		// Rotation keeps length.
+		v_t x(50.0), y(-20.0);
+		sf<16, -8> xo, yo;
+		rotate(x, y, a_t(2.0), xo, yo);
+		assert(fabs(double(xo) - (50*cos(2.0) + 20*sin(2.0))) < 2*ldexp(1.0, -8));
+		assert(fabs(double(yo) - (50*sin(2.0) - 20*cos(2.0))) < 2*ldexp(1.0, -8));
+	}
+
+	////////////////////////////////////
+	// exp2, log2, exp, log
+
+	{
+		// Error is at most epsilon of result type.
+		typedef usf<16, -16> x_t;
+		typedef rt::log2<x_t>::rt l2_t;
+		typedef rt::log<x_t>::rt l_t;
+		static_assert(is_same<l2_t, sf<16, -11>>::value, "log2 type!");
+		static_assert(is_same<l_t, sf<16, -12>>::value, "log type!");
+		vector<x_t> xs(1 << 16);
+		double max_l2 = 0, max_l = 0;
+		for(uint i = 1; i < (1 << 16); i++){
+			xs[i].num = i;
+			double x = ldexp(double(i), -16);
+			auto l2 = log2(xs[i]);
+			auto l = log(xs[i]);
+			max_l2 = max(max_l2, fabs(ldexp(double(l2.num), l2_t::e) - log2(x)));
+			max_l = max(max_l, fabs(ldexp(double(l.num), l_t::e) - log(x)));
+		}
+		assert(max_l2 <= ldexp(1.0, l2_t::e));
+		assert(max_l <= ldexp(1.0, l_t::e));
+		assert(log2(x_t(0.0)).num == -(1 << 16));
+		sf_float_assert(log2(usf<8, 0>(64)), 6);
+		sf_float_assert(log2(sf<15, -12>(0.25)), -2);
+
+		typedef sf<15, -12> a_t;
+		typedef rt::exp2<a_t>::rt e2_t;
+		typedef rt::exp<a_t>::rt e_t;
+		static_assert(is_same<e2_t, usf<20, -12>>::value, "exp2 type!");
+		static_assert(is_same<e_t, usf<24, -12>>::value, "exp type!");
+		vector<a_t> as(1 << 16);
+		double max_e2 = 0, max_e = 0;
+		for(int i = 0; i < (1 << 16); i++){
+			as[i].num = int16_t(i - (1 << 15));
+			double a = ldexp(double(as[i].num), -12);
+			auto e2 = exp2(as[i]);
+			auto e = exp(as[i]);
+			max_e2 = max(max_e2, fabs(ldexp(double(e2.num), e2_t::e) - exp2(a)));
+			max_e = max(max_e, fabs(ldexp(double(e.num), e_t::e) - exp(a)));
+		}
+		assert(max_e2 <= ldexp(1.0, e2_t::e));
+		assert(max_e <= ldexp(1.0, e_t::e));
+		sf_float_assert(exp2(a_t(3)), 8);
+		sf_float_assert(exp2(a_t(-2)), 0.25);
+
+		// Batch is bit exact with scalar.
+		vector<l2_t> bl2(xs.size());
+		vector<l_t> bl(xs.size());
+		log2(xs.data(), bl2.data(), xs.size());
+		log(xs.data(), bl.data(), xs.size());
+		for(size_t i = 0; i < xs.size(); i++){
+			assert(bl2[i] == log2(xs[i]) && bl[i] == log(xs[i]));
+		}
+		vector<e2_t> be2(as.size());
+		vector<e_t> be(as.size());
+		exp2(as.data(), be2.data(), as.size());
+		exp(as.data(), be.data(), as.size());
+		for(size_t i = 0; i < as.size(); i++){
+			assert(be2[i] == exp2(as[i]) && be[i] == exp(as[i]));
+		}
+	}
+
+	////////////////////////////////////
+	// sf_lut
+
+	{
+		// Narrow input is tabulated exactly, at compile time.
+		typedef sf<9, -6> n_t;
+		typedef sf<15, -15> o_t;
+		typedef sf_lut<softsign_fn, n_t, o_t> ss_t;
+		static_assert(ss_t::compile_time, "Static f() is compile time!");
+		static_assert(ss_t::size == 1025, "Whole input is tabulated!");
+		ss_t ss;
+		for(int i = -512; i < 512; i++){
+			n_t x;
+			x.num = i;
+			double y = ldexp(round(ldexp(softsign_fn::f(float(x)), 15)), -15);
+			assert(double(ss(x)) == y);
+		}
+
+		// Wide input is interpolated, table is built at first use.
+		typedef sf<20, -16> w_t;
+		typedef usf<16, -16> p_t;
+		typedef sf_lut<sigmoid_fn, w_t, p_t, 8, lut_nearest> sn_t;
+		typedef sf_lut<sigmoid_fn, w_t, p_t, 8, lut_linear> sl_t;
+		typedef sf_lut<sigmoid_fn, w_t, p_t, 8, lut_quadratic> sq_t;
+		static_assert(!sq_t::compile_time, "Functor is run time!");
+		sn_t sn;
+		sl_t sl;
+		sq_t sq;
+		double max_n = 0, max_l = 0, max_q = 0;
+		vector<w_t> xs;
+		for(int64_t i = -(1 << 20); i < (1 << 20); i += 17){
+			w_t x;
+			x.num = int32_t(i);
+			xs.push_back(x);
+			double y = sigmoid_fn()(ldexp(double(i), -16));
+			max_n = max(max_n, fabs(ldexp(double(sn(x).num), -16) - y));
+			max_l = max(max_l, fabs(ldexp(double(sl(x).num), -16) - y));
+			max_q = max(max_q, fabs(ldexp(double(sq(x).num), -16) - y));
+		}
+		// Errors in LSB.
+		assert(max_n*65536 < 1100);
+		assert(max_l*65536 < 16);
+		assert(max_q*65536 < 1.5);
+
+		// Batch is bit exact with scalar.
+		vector<p_t> ys(xs.size());
+		sq(xs.data(), ys.data(), xs.size());
+		for(size_t i = 0; i < xs.size(); i++){
+			assert(ys[i] == sq(xs[i]));
+		}
+
+		// Wide output, products of 64 bit coefficients don't overflow.
+		typedef sf<42, -32> l_t;
+		sf_lut<step_fn, w_t, l_t> st;
+		sf_lut<step_fn, w_t, l_t, 8, lut_quadratic> stq;
+		l_t prev = st(xs[0]);
+		for(size_t i = 0; i < xs.size(); i++){
+			const double y = double(st(xs[i]));
+			const double yq = double(stq(xs[i]));
+			assert(y >= -1000 && y <= 1000 && !(st(xs[i]) < prev));
+			assert(yq >= -1000*1.5 && yq <= 1000*1.5);
+			prev = st(xs[i]);
+		}
+		w_t x0;
+		x0.num = -(1 << 11);
+		assert(fabs(double(st(x0))) < 1000);
+	}
+
+	////////////////////////////////////
+	// poly_eval
+
+	{
+		// Taylor series of exp, with coefficients in Q20.
+		typedef sf_const<1> c0;
+		typedef sf_const<1> c1;
+		typedef sf_const<1, -1> c2;
+		typedef sf_const<174763, -20> c3;
+		typedef sf_const<43691, -20> c4;
+		typedef sf_const<8738, -20> c5;
+		typedef sf_const<1456, -20> c6;
+		typedef sf_const<208, -20> c7;
+		const double c[] = {
+			1, 1, 0.5, ldexp(174763, -20), ldexp(43691, -20),
+			ldexp(8738, -20), ldexp(1456, -20), ldexp(208, -20)
+		};
+
+		// Result is within LSB of exact value of polynomial.
+		typedef usf<16, -16> x_t;
+		typedef sf<20, -18> y_t;
+		double max_h = 0, max_e = 0;
+		vector<x_t> xs;
+		for(int i = 0; i < (1 << 16); i++){
+			x_t x;
+			x.num = i;
+			xs.push_back(x);
+			double v = ldexp(double(i), -16), p = 0;
+			for(int k = 7; k >= 0; k--){
+				p = p*v + c[k];
+			}
+			y_t h = poly_eval<y_t, c0, c1, c2, c3, c4, c5, c6, c7>(x);
+			y_t e = poly_eval_estrin<y_t, c0, c1, c2, c3, c4, c5, c6, c7>(x);
+			max_h = max(max_h, fabs(ldexp(double(h.num), -18) - p));
+			max_e = max(max_e, fabs(ldexp(double(e.num), -18) - p));
+		}
+		assert(max_h*(1 << 18) < 1);
+		assert(max_e*(1 << 18) < 1);
+
+		// Batch is bit exact with scalar.
+		vector<y_t> ys(xs.size());
+		poly_eval_estrin<y_t, c0, c1, c2, c3, c4, c5, c6, c7>(
+			xs.data(), ys.data(), xs.size()
+		);
+		for(size_t i = 0; i < xs.size(); i += 101){
+			assert((ys[i] ==
+				poly_eval_estrin<y_t, c0, c1, c2, c3, c4, c5, c6, c7>(xs[i])));
+		}
+
+		// Signed argument and coefficients, cos in x^2 for x in [-1, 1).
+		typedef sf<15, -15> s_t;
+		typedef sf<16, -15> z_t;
+		typedef sf_const<-1, -1> d1;
+		typedef sf_const<-1456, -20> d3;
+		const double d[] = {1, -0.5, ldexp(43691, -20), ldexp(-1456, -20)};
+		max_h = max_e = 0;
+		for(int i = -(1 << 15); i < (1 << 15); i++){
+			s_t x;
+			x.num = i;
+			double v = ldexp(double(i), -15), p = 0;
+			for(int k = 3; k >= 0; k--){
+				p = p*v + d[k];
+			}
+			z_t h = poly_eval<z_t, c0, d1, c4, d3>(x);
+			z_t e = poly_eval_estrin<z_t, c0, d1, c4, d3>(x);
+			max_h = max(max_h, fabs(ldexp(double(h.num), -15) - p));
+			max_e = max(max_e, fabs(ldexp(double(e.num), -15) - p));
+		}
+		assert(max_h*(1 << 15) < 1);
+		assert(max_e*(1 << 15) < 1);
+	}
+
+	////////////////////////////////////
+	// sf_accumulator
+
+	{
+		uint64_t seed = 1;
+		auto next = [&seed]() {
+			seed = seed*6364136223846793005ull + 1442695040888963407ull;
+			return int64_t(seed >> 1);
+		};
+
+		// Narrow sum in one limb.
+		typedef sf<15, -15> a_t;
+		typedef rt::mul<a_t, a_t>::rt p_t;
+		typedef sf_accumulator<p_t> n_acc;
+		static_assert(n_acc::narrow, "Sum fits in 64 bits!");
+		n_acc na;
+		int64_t ns = 0;
+		for(int i = 0; i < 10000; i++){
+			a_t x, y;
+			x.num = int16_t(next());
+			y.num = int16_t(next());
+			na.mac(x, y);
+			ns += int64_t(x.num)*y.num;
+		}
+		// Product of -1 and -1 is exact.
+		a_t m1;
+		m1.num = -(1 << 15);
+		na.mac(m1, m1);
+		ns += int64_t(1) << 30;
+		assert(na.sum() == ns);
+
+		// Wide sum in carry-save limbs, merged from partial sums.
+		typedef sf<31, -31> w_t;
+		typedef rt::mul<w_t, w_t>::rt q_t;
+		typedef sf_accumulator<q_t> w_acc;
+		static_assert(!w_acc::narrow, "Sum is wider than 64 bits!");
+		w_acc wa, wb;
+		detail::int128_t ws = 0;
+		vector<w_t> xs(1000), ys(1000);
+		for(int i = 0; i < 1000; i++){
+			// Big positive products, so sum overflows 64 bits.
+			xs[i].num = int32_t(next() | 0x7fff0000) & 0x7fffffff;
+			ys[i].num = int32_t(next() | 0x7fff0000) & 0x7fffffff;
+			ws += detail::int128_t(int64_t(xs[i].num)*ys[i].num);
+		}
+		wa.dot(xs.data(), ys.data(), 500);
+		wb.dot(xs.data() + 500, ys.data() + 500, 500);
+		wa += wb;
+		assert(wa.sum() == ws);
+		for(int i = 0; i < 1000; i++){
+			ys[i].num = -ys[i].num;
+			wa.mac(xs[i], ys[i]);
+		}
+		assert(wa.sum() == 0);
+
+		// Rounding and saturation of result.
+		w_acc r;
+		w_t half;
+		half.num = 1 << 30;
+		for(int i = 0; i < 5; i++){
+			r.mac(half, half);
+		}
+		// 5/4 rounded to 2^-1, 2^0 and 2^-40.
+		assert(double(r.result<sf<4, -1>>()) == 1.5);
+		assert(double(r.result<sf<4, -1>, round_floor>()) == 1);
+		assert(double(r.result<sf<4, 0>>()) == 1);
+		assert(double(r.result<sf<45, -40>>()) == 1.25);
+		assert(double(r.result<sf<2, -2>>()) == 0.75);
+		r.clear();
+		w_t neg_half;
+		neg_half.num = -(1 << 30);
+		r.mac(half, neg_half);
+		assert(double(r.result<usf<4, -2>>()) == 0);
+		assert(double(r.result<sf<4, -2>>()) == -0.25);
+	}
+
+	////////////////////////////////////
+	// parallel
+
+	{
+		typedef sf<15, -15> x_t;
+		const uint N = 1 << 18;
+		const size_t n = 200000;
+		vector<x_t> x(n), y(n);
+		uint32_t seed = 7;
+		for(size_t i = 0; i < n; i++){
+			seed = seed*1103515245 + 12345;
+			x[i].num = int16_t(seed >> 8);
+			y[i].num = int16_t(seed >> 16);
+		}
+
+		typedef rt::sum<x_t, N>::rt s_t;
+		typedef rt::dot<x_t, x_t, N>::rt d_t;
+		static_assert(s_t::b == 15 + 18, "Sum grow for log2(N) bits!");
+
+		// Serial reference.
+		int64_t ref_s = 0, ref_d = 0;
+		for(size_t i = 0; i < n; i++){
+			ref_s += x[i].num;
+			ref_d += int64_t(x[i].num)*y[i].num;
+		}
+
+		auto square = [](const x_t& v) {
+			return v*v;
+		};
+		vector<s_t> scan(n);
+		vector<rt::mul<x_t, x_t>::rt> sq(n);
+		for(
+			uint threads = 1;
+			threads <= 64;
+			threads = threads < 8 ? threads + 1 : threads*2
+		){
+			parallel::thread_pool pool(threads);
+			assert(pool.size() == threads);
+
+			s_t s = parallel::reduce<N>(x.data(), n, pool);
+			assert(s.num == ref_s);
+
+			d_t d = parallel::transform_reduce<N>(x.data(), y.data(), n, pool);
+			assert(d.num == ref_d);
+
+			parallel::transform(x.data(), sq.data(), n, square, pool);
+			auto q = parallel::transform_reduce<N>(x.data(), n, square, pool);
+			int64_t ref_q = 0;
+			for(size_t i = 0; i < n; i++){
+				assert(sq[i] == x[i]*x[i]);
+				ref_q += sq[i].num;
+			}
+			assert(q.num == ref_q);
+
+			parallel::inclusive_scan<N>(x.data(), scan.data(), n, pool);
+			int64_t run = 0;
+			for(size_t i = 0; i < n; i++){
+				run += x[i].num;
+				assert(scan[i].num == run);
+			}
+		}
+	}
+
+	////////////////////////////////////
+	// atomic_sf
+
+	{
+		typedef sf<15, -15> x_t;
+		typedef sf<7, -4> n_t;
+		auto make = [](int v) {
+			n_t r;
+			r.num = int8_t(v);
+			return r;
+		};
+
+		// Single thread semantics.
+		atomic_sf<7, -4> a(make(10));
+		assert(a.fetch_add(make(5)).num == 10);
+		assert(a.load().num == 15);
+		assert(a.fetch_sub(make(20)).num == 15);
+		assert((a += make(1)).num == -4);
+		assert(a.exchange(make(100)).num == -4);
+		assert(a.fetch_add_sat(make(100)).num == 100);
+		assert(a.load().num == 127);
+		a.store(make(-100));
+		a.fetch_add_sat(make(-100));
+		assert(a.load().num == -128);
+		n_t e = make(0);
+		assert(!a.compare_exchange_strong(e, make(1)));
+		assert(e.num == -128);
+		assert(a.compare_exchange_strong(e, make(1)));
+		assert(a.fetch_max(make(50)).num == 1);
+		assert(a.fetch_min(make(60)).num == 50);
+		assert(a.fetch_min(make(-3)).num == 50);
+		assert(n_t(a).num == -3);
+
+		atomic_usf<8, -8> u;
+		u.fetch_add_sat(usf<8, -8>(0.75));
+		u.fetch_add_sat(usf<8, -8>(0.75));
+		assert(u.load().num == 255);
+
+		// Concurrent adds, min and max are exact.
+		const int threads = 8;
+		const int n = 20000;
+		atomic_sf<40, -15> sum;
+		atomic_sf<15, -15> lo, hi;
+		sf_striped_sum<x_t> striped;
+		vector<thread> ts;
+		for(int t = 0; t < threads; t++){
+			ts.emplace_back([&, t]{
+				for(int i = 0; i < n; i++){
+					x_t x;
+					x.num = int16_t(i*(t + 1) - 10000);
+					sf<40, -15> w;
+					w.num = x.num;
+					sum.fetch_add(w);
+					lo.fetch_min(x);
+					hi.fetch_max(x);
+					striped.add(x);
+				}
+			});
+		}
+		for(thread& t : ts){
+			t.join();
+		}
+		int64_t ref = 0, ref_lo = 0, ref_hi = 0;
+		for(int t = 0; t < threads; t++){
+			for(int i = 0; i < n; i++){
+				int16_t v = int16_t(i*(t + 1) - 10000);
+				ref += v;
+				ref_lo = min<int64_t>(ref_lo, v);
+				ref_hi = max<int64_t>(ref_hi, v);
+			}
+		}
+		assert(sum.load().num == ref);
+		assert(lo.load().num == ref_lo);
+		assert(hi.load().num == ref_hi);
+		assert(striped.sum().num == ref);
+		striped.clear();
+		assert(striped.sum().num == 0);
+
+		// Saturation at full 64 bit width.
+		atomic_sf<63, -20> a63;
+		sf<63, -20> big;
+		big.num = INT64_MAX - 5;
+		a63.store(big);
+		a63.fetch_add_sat(big);
+		assert(a63.load().num == INT64_MAX);
+		big.num = INT64_MIN + 5;
+		a63.store(big);
+		a63.fetch_add_sat(big);
+		assert(a63.load().num == INT64_MIN);
+		atomic_usf<64, -64> a64;
+		usf<64, -64> ubig;
+		ubig.num = UINT64_MAX - 5;
+		a64.store(ubig);
+		ubig.num = 3;
+		assert(a64.fetch_add_sat(ubig).num == UINT64_MAX - 5);
+		a64.fetch_add_sat(ubig);
+		assert(a64.load().num == UINT64_MAX);
+
+		// Default count of terms keeps sum of wide terms in 64 bits.
+		static_assert(
+			is_same<sf_striped_sum<x_t>::result_type, sf<47, -15>>::value
+				&& is_same<
+					sf_striped_sum<sf<40, -10>>::result_type,
+					sf<63, -10>
+				>::value,
+			"Striped sum type!"
+		);
+		sf_striped_sum<sf<40, -10>> wide;
+		sf<40, -10> t;
+		t.num = int64_t(1) << 39;
+		wide.add(t);
+		wide.add(t);
+		assert(wide.sum().num == int64_t(1) << 40);
+
+#ifdef __GCC_HAVE_SYNC_COMPARE_AND_SWAP_16
+		// 128 bit with cmpxchg16b.
+		atomic_sf<100, -50> w;
+		sf<100, -50> one;
+		one.num = detail::int128_t(1) << 70;
+		w.fetch_add(one);
+		w.fetch_add(one);
+		assert(w.load().num == detail::int128_t(1) << 71);
+#endif
+	}
+
+	////////////////////////////////////
+	// sf_span
+
+	{
+		// Samples as they come from device.
+		int16_t raw[1000];
+		uint16_t uraw[1000];
+		for(int i = 0; i < 1000; i++){
+			raw[i] = int16_t(i*37 - 18000);
+			uraw[i] = uint16_t(i*61 + 1);
+		}
+
+		sf_span<15, -15> s(raw, 1000);
+		assert(s.size() == 1000 && !s.empty());
+		assert(s.nums() == raw);
+		assert(s[3].num == raw[3]);
+		assert(double(s[0]) == ldexp(-18000.0, -15));
+
+		// Writes go to buffer.
+		s[1] = sf<15, -15>(0.5);
+		assert(raw[1] == 1 << 14);
+		for(sf<15, -15>& x : s.subspan(990)){
+			x.num = 0;
+		}
+		assert(raw[989] != 0 && raw[990] == 0 && raw[999] == 0);
+		assert(s.subspan(10, 20).size() == 20);
+		assert(s.subspan(10, 20)[0].num == raw[10]);
+
+		// Read only view of const buffer, and of mutable view.
+		const int16_t* craw = raw;
+		const_sf_span<15, -15> cs(craw, 1000);
+		const_sf_span<15, -15> cs2 = s;
+		assert(cs.data() == cs2.data());
+
+		// Batch kernels work in place of buffer.
+		int64_t ref = 0;
+		for(int i = 0; i < 1000; i++){
+			ref += raw[i];
+		}
+		assert((parallel::reduce<1024>(cs.data(), cs.size()).num == ref));
+
+		usf_span<16, -16> us(uraw, 1000);
+		vector<rt::log2<usf<16, -16>>::rt> l2(us.size());
+		log2(us.data(), l2.data(), us.size());
+		for(int i = 0; i < 1000; i++){
+			assert(l2[i] == log2(us[i]));
+		}
+	}
+
+	////////////////////////////////////
+	// sf_file
+
+	{
+		const char* path = "static_float_test.sfa";
+		vector<sf<15, -15>> x(1000);
+		for(int i = 0; i < 1000; i++){
+			x[i].num = int16_t(i*37 - 18000);
+		}
+
+		// Raw file is viewed in place.
+		{
+			sf_file_writer<sf<15, -15>> w(path);
+			w.write(x.data(), 600);
+			w.write(x.data() + 600, 400);
+		}
+		{
+			sf_file f(path);
+			assert(f.size() == 1000 && f.b() == 15 && f.e() == -15);
+			assert(f.is_signed() && f.packing() == sf_file_raw);
+			assert((f.is_view_of<sf<15, -15>>()));
+			assert((!f.is_view_of<sf<15, -14>>() && !f.is_view_of<usf<15, -15>>()));
+			const_sf_span<15, -15> v = f.view<sf<15, -15>>();
+			for(int i = 0; i < 1000; i++){
+				assert(v[i].num == x[i].num);
+			}
+			bool thrown = false;
+			try{
+				f.view<sf<16, -15>>();
+			}catch(exceptions::exception&){
+				thrown = true;
+			}
+			assert(thrown);
+
+			// Other type is converted, with rounding and saturation.
+			vector<sf<20, -17>> fine = f.load<sf<20, -17>>();
+			vector<sf<8, -8>> coarse = f.load<sf<8, -8>>();
+			vector<sf<7, -10>> sat = f.load<sf<7, -10>>();
+			for(int i = 0; i < 1000; i++){
+				assert(fine[i].num == x[i].num*4);
+				assert(coarse[i].num == int(floor(x[i].num/128.0 + 0.5)));
+				const int s = int(floor(x[i].num/32.0 + 0.5));
+				assert(sat[i].num == (s > 127 ? 127 : s < -128 ? -128 : s));
+			}
+		}
+
+		// Bytes of big endian file are swapped.
+		{
+			sf_file_writer<sf<15, -15>> w(path, sf_file_raw, sf_file_big);
+			w.write(x.data(), 1000);
+		}
+		{
+			sf_file f(path);
+			assert((f.order() == sf_file_big && !f.is_view_of<sf<15, -15>>()));
+			vector<sf<15, -15>> y = f.load<sf<15, -15>>();
+			for(int i = 0; i < 1000; i++){
+				assert(y[i].num == x[i].num);
+			}
+		}
+
+		// Packed bits, for any width.
+		vector<sf<10, -6>> p(999);
+		vector<usf<45, -30>> q(999);
+		for(int i = 0; i < 999; i++){
+			p[i].num = int16_t(i*7 % 2048 - 1024);
+			q[i].num = (uint64_t(i) << 35) ^ uint64_t(i*123457);
+		}
+		write_sf_file(path, p.data(), p.size(), sf_file_bits);
+		{
+			sf_file f(path);
+			assert((f.packing() == sf_file_bits && !f.is_view_of<sf<10, -6>>()));
+			vector<sf<10, -6>> y = f.load<sf<10, -6>>();
+			for(int i = 0; i < 999; i++){
+				assert(y[i].num == p[i].num);
+			}
+		}
+		write_sf_file(path, q.data(), q.size(), sf_file_bits);
+		{
+			sf_file f(path);
+			assert(!f.is_signed() && f.b() == 45);
+			vector<usf<45, -30>> y = f.load<usf<45, -30>>();
+			for(int i = 0; i < 999; i++){
+				assert(y[i].num == q[i].num);
+			}
+		}
+
+		vector<sf<60, -40>> r(999);
+		for(int i = 0; i < 999; i++){
+			r[i].num = int64_t(i - 500)*(int64_t(1) << 50) ^ int64_t(i)*7654321;
+		}
+		write_sf_file(path, r.data(), r.size(), sf_file_bits);
+		{
+			sf_file f(path);
+			vector<sf<60, -40>> y = f.load<sf<60, -40>>();
+			for(int i = 0; i < 999; i++){
+				assert(y[i].num == r[i].num);
+			}
+		}
+
+		// Unsigned 64 bit elements above 2^63 are not taken as negative.
+		usf<64, -64> u[3];
+		u[0].num = ~uint64_t(0);
+		u[1].num = uint64_t(1) << 63;
+		u[2].num = 6;
+		for(int k = 0; k < 2; k++){
+			write_sf_file(path, u, 3, k ? sf_file_bits : sf_file_raw);
+			sf_file f(path);
+			vector<usf<62, -62>> y = f.load<usf<62, -62>>();
+			assert(y[0].num == (uint64_t(1) << 62) - 1);
+			assert(y[1].num == uint64_t(1) << 61 && y[2].num == 2);
+			vector<sf<20, -18>> z = f.load<sf<20, -18>>();
+			assert(z[0].num == 1 << 18 && z[1].num == 1 << 17 && z[2].num == 0);
+		}
+
+		// Signed 64 bit elements are rounded without overflow.
+		sf<63, -63> s[3];
+		s[0].num = INT64_MAX;
+		s[1].num = INT64_MIN;
+		s[2].num = -3;
+		for(int k = 0; k < 2; k++){
+			write_sf_file(path, s, 3, k ? sf_file_bits : sf_file_raw);
+			sf_file f(path);
+			vector<sf<62, -62>> y = f.load<sf<62, -62>>();
+			assert(y[0].num == INT64_MAX/2 && y[1].num == INT64_MIN/2);
+			assert(y[2].num == -1);
+		}
+
+		// Header with count beyond file, and with count*bits
+		// which overflows, is rejected.
+		for(int k = 0; k < 2; k++){
+			write_sf_file(path, x.data(), 100, k ? sf_file_bits : sf_file_raw);
+			FILE* o = fopen(path, "r+b");
+			fseek(o, 16, SEEK_SET);
+			const uint8_t c[8] = {0, 0, 0, 0, 0, 0, 0, 0x20};
+			fwrite(c, 1, 8, o);
+			fclose(o);
+			bool thrown = false;
+			try{
+				sf_file f(path);
+			}catch(exceptions::exception&){
+				thrown = true;
+			}
+			assert(thrown);
+		}
+
+		// Data at unaligned offset is not viewed.
+		{
+			write_sf_file(path, x.data(), 100);
+			FILE* o = fopen(path, "r+b");
+			vector<uint8_t> d(64 + 200);
+			assert(fread(d.data(), 1, d.size(), o) == d.size());
+			d.insert(d.begin() + 64, 0);
+			d[40] = 65;
+			fseek(o, 0, SEEK_SET);
+			fwrite(d.data(), 1, d.size(), o);
+			fclose(o);
+			sf_file f(path);
+			assert((!f.is_view_of<sf<15, -15>>()));
+			vector<sf<15, -15>> y = f.load<sf<15, -15>>();
+			assert(y[99].num == x[99].num);
+		}
+
+		// Other file is rejected.
+		FILE* o = fopen(path, "wb");
+		for(int i = 0; i < 100; i++){
+			fputc(i, o);
+		}
+		fclose(o);
+		bool thrown = false;
+		try{
+			sf_file f(path);
+		}catch(exceptions::exception&){
+			thrown = true;
+		}
+		assert(thrown);
+		remove(path);
+	}
+
+	////////////////////////////////////
+	// sf_compressed, sf_encoder, sf_decoder
+
+	{
+		// Slow sine with noise of few LSBs, as from sensor.
+		const size_t n = 10037;
+		vector<sf<20, -10>> x(n);
+		srand(7);
+		for(size_t i = 0; i < n; i++){
+			x[i].num = int32_t(floor(300000*sin(i*0.001) + 0.5)) + rand() % 7 - 3;
+		}
+		sf_compressed<sf<20, -10>> c(x.data(), n);
+		assert(c.size() == n && c.blocks() == (n + 127)/128);
+		assert(c.data().size() < n*sizeof(int32_t)/4);
+		vector<sf<20, -10>> y(n);
+		c.decode(y.data());
+		for(size_t i = 0; i < n; i++){
+			assert(y[i].num == x[i].num);
+		}
+		for(size_t i = 0; i < n; i += 97){
+			assert(c.at(i).num == x[i].num);
+		}
+		assert(c.at(n - 1).num == x[n - 1].num);
+
+		// Stream in pieces of any size gives same blocks.
+		sf_encoder<sf<20, -10>> enc;
+		vector<uint8_t> coded;
+		for(size_t i = 0; i < n;){
+			const size_t k = min(size_t(rand() % 300), n - i);
+			enc.write(x.data() + i, k, coded);
+			i += k;
+		}
+		enc.flush(coded);
+		assert(coded == c.data());
+		sf_decoder<sf<20, -10>> dec(coded.data(), coded.size());
+		vector<sf<20, -10>> z(n + 10);
+		size_t got = 0;
+		for(size_t k; (k = dec.read(z.data() + got, rand() % 300)) > 0;){
+			got += k;
+		}
+		assert(got == n);
+		for(size_t i = 0; i < n; i++){
+			assert(z[i].num == x[i].num);
+		}
+		sf_compressed<sf<20, -10>> ci(coded);
+		assert(ci.size() == n && ci.at(5000).num == x[5000].num);
+
+		// Constant, ramp and parabola are coded with no bits per element.
+		vector<sf<20, -10>> k(128), r(128), q(128);
+		for(int i = 0; i < 128; i++){
+			k[i].num = -5;
+			r[i].num = 7*i - 400;
+			q[i].num = i*i - 3*i;
+		}
+		assert((sf_compressed<sf<20, -10>>(k.data(), 128).data().size() <= 4));
+		assert((sf_compressed<sf<20, -10>>(r.data(), 128).data().size() <= 6));
+		assert((sf_compressed<sf<20, -10>>(q.data(), 128).data().size() <= 8));
+
+		// Full range and every length of short block.
+		vector<sf<63, 0>> w(300);
+		vector<usf<32, -32>> u(300);
+		for(int i = 0; i < 300; i++){
+			w[i].num = int64_t((uint64_t(rand()) << 40) ^ (uint64_t(rand()) << 10));
+			u[i].num = uint32_t(rand()) << 1;
+		}
+		w[3].num = INT64_MAX;
+		w[4].num = INT64_MIN;
+		for(size_t m = 1; m <= 300; m += 13){
+			sf_compressed<sf<63, 0>> cw(w.data(), m);
+			sf_compressed<usf<32, -32>> cu(u.data(), m);
+			vector<sf<63, 0>> wy(m);
+			vector<usf<32, -32>> uy(m);
+			cw.decode(wy.data());
+			cu.decode(uy.data());
+			for(size_t i = 0; i < m; i++){
+				assert(wy[i].num == w[i].num && uy[i].num == u[i].num);
+			}
+		}
+
+		bool thrown = false;
+		try{
+			coded.resize(coded.size() - 1);
+			sf_compressed<sf<20, -10>> bad(coded);
+		}catch(exceptions::exception&){
+			thrown = true;
+		}
+		assert(thrown);
+	}
+
+	////////////////////////////////////
+	// to_chars, from_chars
+
+	{
+		typedef sf<15, -15> q15;
+		char buf[400];
+		auto str = [&](char* e){
+			return string(buf, e);
+		};
+
+		q15 a;
+		a.num = -1;
+		assert(str(to_chars(buf, buf + 400, a)) == "-0.00003");
+		a.num = 16384;
+		assert(str(to_chars(buf, buf + 400, a)) == "0.5");
+		a.num = 0;
+		assert(str(to_chars(buf, buf + 400, a)) == "0");
+		a.num = 12345;
+		assert(str(to_chars(buf, buf + 400, a)) == "0.37674");
+		assert(to_chars(buf, buf + 3, a) == nullptr);
+		sf<20, 4> b;
+		b.num = -1000;
+		assert(str(to_chars(buf, buf + 400, b)) == "-16000");
+		usf<64, -64> c;
+		c.num = ~uint64_t(0);
+		assert(str(to_chars(buf, buf + 400, c)) == "0.99999999999999999995");
+		sf<200, -150> g;
+		g.num = 3;
+		g.num <<= 190;
+		ostringstream oss;
+		oss << g << ' ' << a;
+		assert(oss.str() == "3298534883328 0.37674");
+
+		// All values of q15 round trip.
+		for(int n = -32768; n < 32768; n++){
+			a.num = int16_t(n);
+			char* e = to_chars(buf, buf + 400, a);
+			q15 r;
+			const sf_parse_result pr = from_chars(buf, e, r);
+			assert(pr.ptr == e && pr.status == sf_parse_ok && r.num == a.num);
+		}
+
+		// Round trip of random values of wide types.
+		srand(11);
+		auto rnd64 = []{
+			return (uint64_t(rand()) << 42) ^ (uint64_t(rand()) << 21) ^ uint64_t(rand());
+		};
+		for(int i = 0; i < 2000; i++){
+			sf<63, -60> x;
+			x.num = int64_t(rnd64()) >> (rand() % 60);
+			sf<63, -60> y;
+			from_chars(buf, to_chars(buf, buf + 400, x), y);
+			assert(y.num == x.num);
+
+			usf<32, 10> u;
+			u.num = uint32_t(rnd64());
+			usf<32, 10> v;
+			from_chars(buf, to_chars(buf, buf + 400, u), v);
+			assert(v.num == u.num);
+
+			sf<100, -90> w;
+			w.num = detail::int128_t(int64_t(rnd64())) << (rand() % 36);
+			sf<100, -90> z;
+			from_chars(buf, to_chars(buf, buf + 400, w), z);
+			assert(z.num == w.num);
+
+			sf<200, -150> h;
+			h.num = int64_t(rnd64());
+			h.num <<= rand() % 130;
+			sf<200, -150> k;
+			from_chars(buf, to_chars(buf, buf + 400, h), k);
+			assert(k.num == h.num);
+		}
+
+		// Narrow type with more than 63 fraction bits.
+		for(int i = -8; i < 8; i++){
+			sf<3, -70> a, b;
+			a.num = int8_t(i);
+			from_chars(buf, to_chars(buf, buf + 400, a), b);
+			assert(b.num == a.num);
+		}
+
+		// Rounding of decimals of any length, to nearest, halves up.
+		auto parse = [](const char* s, q15& r){
+			return from_chars(s, s + strlen(s), r);
+		};
+		q15 r;
+		assert(parse("0.37671", r).status == sf_parse_ok && r.num == 12344);
+		assert(parse("+3.0517578125e-5", r).status == sf_parse_ok && r.num == 1);
+		assert(parse("1.52587890625e-5", r).status == sf_parse_ok && r.num == 1);
+		assert(parse("-1.52587890625e-5", r).status == sf_parse_ok && r.num == 0);
+		assert(parse("-1.52587890625000000000000001e-5", r).status == sf_parse_ok);
+		assert(r.num == -1);
+		assert(parse("1.5258789062499999999999999999999999e-5", r).status == sf_parse_ok);
+		assert(r.num == 0);
+		assert(parse("00000.99997", r).status == sf_parse_ok && r.num == 32767);
+		assert(parse("0.99999999", r).status == sf_parse_out_of_range);
+		assert(r.num == 32767);
+		assert(parse("-1e5", r).status == sf_parse_out_of_range && r.num == -32768);
+		assert(parse("-1", r).status == sf_parse_ok && r.num == -32768);
+		assert(parse("1e-99999", r).status == sf_parse_ok && r.num == 0);
+		const char* s = "0.25e";
+		sf_parse_result pr = parse(s, r);
+		assert(pr.ptr == s + 4 && r.num == 8192);
+		s = "-.";
+		pr = parse(s, r);
+		assert(pr.ptr == s && pr.status == sf_parse_invalid);
+		usf<16, -16> un;
+		s = "-0.00001";
+		assert(from_chars(s, s + 8, un).status == sf_parse_out_of_range);
+		assert(un.num == 0);
+
+#ifdef HAVE_GMP
+		// Random decimals against exact rational rounding.
+		for(int i = 0; i < 3000; i++){
+			string d;
+			const int nd = 1 + rand() % 30;
+			for(int j = 0; j < nd; j++){
+				d += char('0' + rand() % 10);
+			}
+			const int point = rand() % (nd + 1);
+			const bool neg = rand() % 2;
+			string t = (neg ? "-" : "") + d.substr(0, point) + "." + d.substr(point);
+			if(point == 0 && rand() % 2){
+				t = (neg ? "-" : "") + d + "e-" + to_string(nd);
+			}
+			from_chars(t.data(), t.data() + t.size(), r);
+			// floor(v*2^15 + 1/2), v = digits/10^(nd - point).
+			mpz_class num(d, 10), den = 1;
+			for(int j = point; j < nd; j++){
+				den *= 10;
+			}
+			if(neg){
+				num = -num;
+			}
+			mpz_class ref;
+			mpz_class top = 2*num*32768 + den;
+			mpz_class bot = 2*den;
+			mpz_fdiv_q(ref.get_mpz_t(), top.get_mpz_t(), bot.get_mpz_t());
+			ref = ref > 32767 ? mpz_class(32767) : ref < -32768 ? mpz_class(-32768) : ref;
+			assert(r.num == ref.get_si());
+		}
+#endif
+
+		// CSV column.
+		vector<q15> col(1000), back(1000);
+		for(int i = 0; i < 1000; i++){
+			col[i].num = int16_t(i*65 - 32000);
+		}
+		vector<char> text(1000*(max_decimal_chars<q15>() + 1));
+		char* end = format_csv_column(col.data(), col.size(), text.data());
+		assert(parse_csv_column(text.data(), end, back.data(), 1000) == 1000);
+		for(int i = 0; i < 1000; i++){
+			assert(back[i].num == col[i].num);
+		}
+		const string csv = "id,value,x\r\n1, 0.5 ,a\r\n2,-0.25,b\n3,1e-1,c";
+		const char* body = strchr(csv.data(), '\n') + 1;
+		q15 vals[4];
+		assert(parse_csv_column(body, csv.data() + csv.size(), vals, 4, 1) == 3);
+		assert(vals[0].num == 16384 && vals[1].num == -8192 && vals[2].num == 3277);
+		bool thrown = false;
+		try{
+			parse_csv_column(csv.data(), csv.data() + csv.size(), vals, 4, 1);
+		}catch(exceptions::exception&){
+			thrown = true;
+		}
+		assert(thrown);
+	}
+
+	////////////////////////////////////
+	// floor, ceil, trunc, round, fract, modf, sign
+
+	{
+		static_assert(is_same<rt::floor<sf<7, -3>>::rt, sf<4, 0>>::value, "");
+		static_assert(is_same<rt::ceil<sf<7, -3>>::rt, sf<5, 0>>::value, "");
+		static_assert(is_same<rt::fract<sf<7, -3>>::rt, usf<3, -3>>::value, "");
+		static_assert(is_same<rt::modf<sf<7, -3>>::rt, sf<3, -3>>::value, "");
+		static_assert(is_same<rt::floor<usf<8, 2>>::rt, usf<8, 2>>::value, "");
+		static_assert(is_same<rt::round<sf<5, -8>>::rt, sf<1, 0>>::value, "");
+
+		// All values against float, with fraction, without integer bits
+		// and without fraction.
+		for(int n = -128; n < 128; n++){
+			sf<7, -3> a;
+			a.num = n;
+			test_rounding(a);
+			sf<5, -8> b;
+			b.num = n >> 2;
+			test_rounding(b);
+			sf<5, -6> c;
+			c.num = n >> 2;
+			test_rounding(c);
+			sf<6, 2> d;
+			d.num = n >> 1;
+			test_rounding(d);
+		}
+		for(int n = 0; n < 256; n++){
+			usf<8, -4> a;
+			a.num = n;
+			test_rounding(a);
+			usf<6, -7> b;
+			b.num = n >> 2;
+			test_rounding(b);
+			usf<8, -8> c;
+			c.num = n;
+			test_rounding(c);
+		}
+
+		// int64, int128 and big nums.
+		sf<63, -20> w;
+		w.num = INT64_MIN;
+		assert(floor(w).num == -(int64_t(1) << 43));
+		assert(ceil(w).num == -(int64_t(1) << 43));
+		w.num = INT64_MAX;
+		assert(ceil(w).num == int64_t(1) << 43 && round(w).num == int64_t(1) << 43);
+		assert(floor(w).num == (int64_t(1) << 43) - 1);
+		assert(fract(w).num == (1 << 20) - 1);
+		sf<100, -90> x;
+		x.num = -(detail::int128_t(5) << 89);
+		assert(floor(x).num == -3 && ceil(x).num == -2);
+		assert(trunc(x).num == -2 && round(x).num == -3);
+		assert(fract(x).num == detail::uint128_t(1) << 89);
+		sf<200, -150> y;
+		y.num = -7;
+		y.num <<= 148;
+		assert(floor(y).num == -2 && ceil(y).num == -1 && round(y).num == -2);
+		assert(fract(y).num == detail::uint_big_t(1) << 148);
+		y.num += 1;
+		assert(round(y).num == -2 && trunc(y).num == -1);
+
+		// Batch.
+		vector<sf<15, -8>> in(1000);
+		vector<sf<7, 0>> fl(1000);
+		vector<sf<8, 0>> ro(1000);
+		vector<usf<8, -8>> fr(1000);
+		for(int i = 0; i < 1000; i++){
+			in[i].num = int16_t(i*65 - 32000);
+		}
+		floor(in.data(), fl.data(), 1000);
+		round(in.data(), ro.data(), 1000);
+		fract(in.data(), fr.data(), 1000);
+		for(int i = 0; i < 1000; i++){
+			assert(fl[i].num == floor(in[i]).num && ro[i].num == round(in[i]).num);
+			assert(fr[i].num == fract(in[i]).num);
+		}
+	}
+
+	////////////////////////////////////
+	// min, max, clamp, mix, step, smoothstep
+
+	{
+		sf<7, -4> a(1.5f);
+		sf<4, 0> b(-3);
+		auto m = min(a, b);
+		static_assert(is_same<decltype(m), sf<8, -4>>::value, "");
+		assert(float(m) == -3.0f && float(max(a, b)) == 1.5f);
+		assert(float(min(a, sf<7, -4>(-2.0f))) == -2.0f);
+		assert(float(max(usf<4, 0>(9), usf<8, -8>(0.5f))) == 9.0f);
+		assert(min(3, 4) == 3 && max(3.0, 4.0) == 4.0);
+		assert(float(clamp(a, sf<7, -4>(-1), sf<7, -4>(1))) == 1.0f);
+		assert(float(clamp(usf<8, -4>(0.25f), usf<8, -4>(0.5f), usf<8, -4>(2)))
+			== 0.5f);
+
+		// mix is exact.
+		sf<7, -4> x(-2.5f), y(3.0f);
+		usf<8, -8> t;
+		for(int n = 0; n < 256; n++){
+			t.num = n;
+			auto r = mix(x, y, t);
+			static_assert(is_same<decltype(r), sf<15, -12>>::value, "");
+			assert(float(r) == -2.5f + 5.5f*n/256);
+			assert(lerp(x, y, t).num == r.num);
+		}
+		usf<1, 0> one(1);
+		assert(float(mix(usf<8, 0>(10), usf<8, 0>(200), one)) == 200.0f);
+		// Weight with many more fraction bits than bits.
+		usf<1, -20> fine;
+		fine.num = 1;
+		auto fm = mix(sf<7, 0>(-3.0f), sf<7, 0>(5.0f), fine);
+		static_assert(is_same<decltype(fm), sf<27, -20>>::value, "");
+		assert(fm.num == -3145720);
+		usf<2, -40> fine2;
+		fine2.num = 3;
+		auto um = mix(usf<8, 0>(200), usf<8, 0>(10), fine2);
+		assert(um.num == (uint64_t(200) << 40) - 190*3);
+
+		sf<7, -4> c(-3.0f);
+		assert(step(a, c).num == 0 && step(c, a).num == 1 && step(a, a).num == 1);
+
+		sf<7, -4> e0(-1), e1(1);
+		assert(smoothstep(e0, e1, sf<7, -4>(-4)).num == 0);
+		assert(float(smoothstep(e0, e1, sf<7, -4>(5))) == 1.0f);
+		assert(float(smoothstep(e0, e1, sf<7, -4>(0))) == 0.5f);
+		float prev = 0;
+		for(int n = -16; n <= 16; n++){
+			sf<7, -4> v;
+			v.num = n;
+			const float s = float(smoothstep(e0, e1, v));
+			const float u = (n + 16)/32.0f;
+			assert(s >= prev && fabs(s - u*u*(3 - 2*u)) < 2.0f/128);
+			prev = s;
+		}
+
+		// Batch.
+		vector<usf<8, -4>> in(1000), out(1000);
+		vector<usf<8, -4>> c0(1000), c1(1000);
+		vector<usf<4, -4>> w(1000);
+		vector<usf<12, -8>> mo(1000);
+		for(int i = 0; i < 1000; i++){
+			in[i].num = uint8_t(i*7);
+			c0[i].num = uint8_t(i);
+			c1[i].num = uint8_t(i*3);
+			w[i].num = uint8_t(i & 15);
+		}
+		clamp(in.data(), out.data(), 1000, usf<8, -4>(1), usf<8, -4>(10));
+		mix(c0.data(), c1.data(), w.data(), mo.data(), 1000);
+		for(int i = 0; i < 1000; i++){
+			assert(out[i].num == clamp(in[i], usf<8, -4>(1), usf<8, -4>(10)).num);
+			assert(mo[i].num == mix(c0[i], c1[i], w[i]).num);
+		}
+	}
+
+	////////////////////////////////////
+	// scale_pow2, ldexp, compile time shifts
+
+	{
+		sf<7, -4> a(-2.75f);
+		auto h = scale_pow2<-1>(a);
+		static_assert(is_same<decltype(h), sf<7, -5>>::value, "");
+		assert(h.num == a.num && float(h) == -1.375f);
+		auto l = ldexp<3>(a);
+		static_assert(is_same<decltype(l), sf<7, -1>>::value, "");
+		assert(float(l) == -22.0f);
+		static_assert(is_same<
+			rt::scale_pow2<usf<9, 2>, -7>::rt, usf<9, -5>
+		>::value, "");
+
+		auto r = a >> shift<2>();
+		static_assert(is_same<decltype(r), sf<7, -6>>::value, "");
+		assert(r.num == a.num && float(r) == -2.75f/4);
+		auto q = a << shift<5>();
+		static_assert(is_same<decltype(q), sf<7, 1>>::value, "");
+		assert(float(q) == -88.0f);
+
+		// Halving of sum is exact, and runtime shift loses low bit.
+		usf<8, -7> u(1.0f), v;
+		v.num = 129;
+		auto m = scale_pow2<-1>(u + v);
+		static_assert(is_same<decltype(m), usf<9, -8>>::value, "");
+		assert(float(m) == (1.0f + 129/128.0f)/2);
+		assert(float(u + v) == float((u + v) >> shift<1>())*2);
+		assert(((u + v) >> 1).num == 128);
+
+		sf<200, -190> w;
+		w.num = -3;
+		w.num <<= 100;
+		assert(float(w >> shift<10>()) == float(w)/1024);
+		assert((w >> shift<10>()).num == w.num);
+	}
+
+	////////////////////////////////////
+	// bit_width, clz, ctz, msb_index, popcount, normalize_mantissa
+
+	{
+		// Against loops, for all int8 and uint8 nums.
+		auto ref_width = [](int64_t v){
+			uint w = 0;
+			for(int64_t u = v < 0 ? ~v : v; u; u >>= 1){
+				w++;
+			}
+			return w;
+		};
+		auto ref_ctz = [](int64_t v, uint z){
+			if(v == 0){
+				return z;
+			}
+			uint c = 0;
+			for(; !(v & 1); v >>= 1){
+				c++;
+			}
+			return c;
+		};
+		auto ref_popcount = [](int64_t v){
+			uint c = 0;
+			for(uint64_t u = v < 0 ? -v : v; u; u >>= 1){
+				c += u & 1;
+			}
+			return c;
+		};
+		for(int n = -128; n < 256; n++){
+			if(n < 128){
+				sf<7, -3> a;
+				a.num = n;
+				assert(bit_width(a) == ref_width(n) && clz(a) == 7 - ref_width(n));
+				assert(msb_index(a) == int(ref_width(n)) - 1);
+				assert(ctz(a) == ref_ctz(n, 7) && popcount(a) == ref_popcount(n));
+			}
+			if(n >= 0){
+				usf<8, 2> u;
+				u.num = n;
+				assert(bit_width(u) == ref_width(n) && clz(u) == 8 - ref_width(n));
+				assert(ctz(u) == ref_ctz(n, 8) && popcount(u) == ref_popcount(n));
+			}
+		}
+
+		// Wide nums.
+		sf<63, 0> a;
+		a.num = INT64_MIN;
+		assert(bit_width(a) == 63 && clz(a) == 0 && ctz(a) == 63);
+		assert(popcount(a) == 1);
+		a.num = -1;
+		assert(bit_width(a) == 0 && msb_index(a) == -1 && ctz(a) == 0);
+		usf<64, 0> b;
+		b.num = 0;
+		assert(clz(b) == 64 && ctz(b) == 64);
+		b.num = uint64_t(1) << 63;
+		assert(msb_index(b) == 63 && ctz(b) == 63);
+		sf<100, -20> c;
+		c.num = detail::int128_t(3) << 90;
+		assert(bit_width(c) == 92 && clz(c) == 8 && ctz(c) == 90);
+		c.num = -c.num;
+		assert(bit_width(c) == 92 && popcount(c) == 2);
+		c.num = 0;
+		assert(clz(c) == 100 && ctz(c) == 100);
+		c.num = detail::int128_t(1) << 70;
+		assert(ctz(c) == 70);
+		usf<128, 0> d;
+		d.num = ~detail::uint128_t(0);
+		assert(clz(d) == 0 && ctz(d) == 0 && popcount(d) == 128);
+		sf<200, -100> g;
+		g.num = -5;
+		g.num <<= 150;
+		assert(bit_width(g) == 153 && ctz(g) == 150 && popcount(g) == 2);
+		g.num = -1;
+		assert(bit_width(g) == 0);
+
+		// Mantissa is in [0.5, 1) and value is kept.
+		for(int n = -32768; n < 32768; n += 7){
+			sf<15, -4> x;
+			x.num = int16_t(n);
+			auto nm = normalize_mantissa(x);
+			static_assert(is_same<decltype(nm.m), sf<15, -15>>::value, "");
+			assert(std::ldexp(float(nm.m), nm.e) == float(x));
+			assert(n == 0 || (fabs(float(nm.m)) >= 0.5f && fabs(float(nm.m)) <= 1));
+		}
+		usf<64, 3> y;
+		y.num = 1;
+		auto ny = normalize_mantissa(y);
+		assert(ny.m.num == uint64_t(1) << 63 && ny.e == 4);
+		y.num = 0;
+		ny = normalize_mantissa(y);
+		assert(ny.m.num == 0 && ny.e == 3);
+		sf<200, -100> z = g;
+		z.num <<= 40;
+		auto nz = normalize_mantissa(z);
+		assert(nz.m.num == -(detail::int_big_t(1) << 200) && nz.e == -100 + 40);
+
+		// Batch.
+		vector<sf<15, -15>> in(1000), m(1000);
+		vector<usf<16, -4>> uin(1000);
+		vector<usf<16, -16>> um(1000);
+		vector<sf<31, -8>> win(1000);
+		vector<sf<31, -31>> wm(1000);
+		vector<int> e(1000), ue(1000), we(1000);
+		for(int i = 0; i < 1000; i++){
+			in[i].num = int16_t((i*i*37) >> (i % 16));
+			uin[i].num = uint16_t((i*i*41) >> (i % 16));
+			win[i].num = int32_t((int64_t(i)*i*i*7919) >> (i % 32));
+		}
+		normalize_mantissa(in.data(), m.data(), e.data(), 1000);
+		normalize_mantissa(uin.data(), um.data(), ue.data(), 1000);
+		normalize_mantissa(win.data(), wm.data(), we.data(), 1000);
+		for(int i = 0; i < 1000; i++){
+			auto r = normalize_mantissa(in[i]);
+			assert(m[i].num == r.m.num && e[i] == r.e);
+			auto ur = normalize_mantissa(uin[i]);
+			assert(um[i].num == ur.m.num && ue[i] == ur.e);
+			auto wr = normalize_mantissa(win[i]);
+			assert(wm[i].num == wr.m.num && we[i] == wr.e);
+		}
+	}
+
+	////////////////////////////////////
+
+	// sf_block_array, block floating point
+
+	{
+		typedef sf<40, -20> T;
+		typedef sf_block_array<15, 8> A;
+		const size_t n = 20;
+		T x[n], y[n], r[n];
+		// Blocks of x grow for 2^12, and of y fall for 2^12.
+		for(size_t i = 0; i < n; i++){
+			const int64_t v = int64_t(i*2654435761u % 40000) - 20000;
+			x[i].num = v*(int64_t(1) << (i/8*12));
+			y[i].num = (v/3 + 7)*(int64_t(1) << ((2 - i/8)*12));
+		}
+		auto val = [](const A& a, size_t i){
+			auto v = a.get(i);
+			return ldexp(double(v.m.num), v.e - 15);
+		};
+		auto ulp = [](const A& a, size_t i){
+			return ldexp(1.0, a.blocks[i/8].e);
+		};
+
+		// Conversion, with error of half of ulp of block.
+		A a, b;
+		a.assign(x, n);
+		b.assign(y, n);
+		assert(a.size() == n && a.blocks.size() == 3);
+		a.to(r);
+		for(size_t i = 0; i < n; i++){
+			assert(val(a, i) == double(r[i].num)*ldexp(1.0, T::e));
+			assert(2*fabs(double(r[i].num - x[i].num)) <= ulp(a, i)/ldexp(1.0, T::e));
+		}
+		assert(a.blocks[0].e <= T::e && r[3].num == x[3].num);
+		// Saturated to narrow type.
+		sf<7, 10> s[n];
+		a.to(s);
+		for(size_t i = 0; i < n; i++){
+			const double q = floor(val(a, i)/1024 + 0.5);
+			assert(s[i].num == (q > 127 ? 127 : q < -128 ? -128 : q));
+		}
+
+		// Add and mul, exact for values of blocks, then rounded.
+		A c, d;
+		add(a, b, c);
+		mul(a, b, d);
+		for(size_t i = 0; i < n; i++){
+			assert(fabs(val(c, i) - (val(a, i) + val(b, i))) <= ulp(c, i));
+			assert(2*fabs(val(d, i) - val(a, i)*val(b, i)) <= ulp(d, i));
+		}
+		add(c, a, c);
+		for(size_t k = 0; k < c.blocks.size(); k++){
+			uint w = 0;
+			for(uint i = 0; i < 8; i++){
+				sf<15, 0> m;
+				m.num = c.blocks[k].m[i];
+				w = bit_width(m) > w ? bit_width(m) : w;
+			}
+			assert(w == 15);
+		}
+
+		// Dot, with precision of product.
+		double ref = 0;
+		for(size_t i = 0; i < n; i++){
+			ref += val(a, i)*val(b, i);
+		}
+		auto p = dot(a, b);
+		assert(fabs(ldexp(double(p.m.num), p.e - 31) - ref) <= fabs(ref)*ldexp(1.0, -29));
+
+		// Zero blocks.
+		A z(n);
+		add(z, a, c);
+		mul(z, a, d);
+		for(size_t i = 0; i < n; i++){
+			assert(val(c, i) == val(a, i) && val(d, i) == 0);
+		}
+		assert(d.blocks[1].e == A::block_type::zero_e);
+		p = dot(z, a);
+		assert(p.m.num == 0 && p.e == 0);
+
+		// Renormalize after direct change of mantissas.
+		for(uint i = 0; i < 8; i++){
+			a.blocks[1].m[i] = int16_t(int(i) - 3);
+		}
+		a.blocks[1].e = 5;
+		a.renormalize();
+		assert(a.blocks[1].m[0] == -3*4096 && a.blocks[1].e == 5 - 12);
+		assert(val(a, 8 + 7) == 4*32.0);
+	}
+
 	////////////////////////////////////
 
 	NEW_LINE();
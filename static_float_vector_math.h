@@ -19,12 +19,275 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include "static_float.h"
+#include "static_float_bits.h"
 #include "vector_math.h"
 
 ///////////////////////////////////////////////////////////////////////////////
 
 namespace vector_math {
 
+	/**
+	 * Products are summed in single accumulator,
+	 * with width by rt::dot rule, B1+B2+ceil(log2(N)).
+	 */
+	template<uint B1, int E1, uint B2, int E2>
+	typename rt::dot<
+		static_float::sf<B1, E1>,
+		static_float::sf<B2, E2>,
+		2
+	>::rt
+	dot(
+		const tvec2<static_float::sf<B1, E1>>& x,
+		const tvec2<static_float::sf<B2, E2>>& y
+	) {
+		return static_float::dot<2>(&x.x, &y.x);
+	}
+
+	template<uint B1, int E1, uint B2, int E2>
+	typename rt::dot<
+		static_float::usf<B1, E1>,
+		static_float::usf<B2, E2>,
+		2
+	>::rt
+	dot(
+		const tvec2<static_float::usf<B1, E1>>& x,
+		const tvec2<static_float::usf<B2, E2>>& y
+	) {
+		return static_float::dot<2>(&x.x, &y.x);
+	}
+
+	template<uint B1, int E1, uint B2, int E2>
+	typename rt::dot<
+		static_float::sf<B1, E1>,
+		static_float::usf<B2, E2>,
+		2
+	>::rt
+	dot(
+		const tvec2<static_float::sf<B1, E1>>& x,
+		const tvec2<static_float::usf<B2, E2>>& y
+	) {
+		return static_float::dot<2>(&x.x, &y.x);
+	}
+
+	template<uint B1, int E1, uint B2, int E2>
+	typename rt::dot<
+		static_float::sf<B1, E1>,
+		static_float::sf<B2, E2>,
+		3
+	>::rt
+	dot(
+		const tvec3<static_float::sf<B1, E1>>& x,
+		const tvec3<static_float::sf<B2, E2>>& y
+	) {
+		return static_float::dot<3>(&x.x, &y.x);
+	}
+
+	template<uint B1, int E1, uint B2, int E2>
+	typename rt::dot<
+		static_float::usf<B1, E1>,
+		static_float::usf<B2, E2>,
+		3
+	>::rt
+	dot(
+		const tvec3<static_float::usf<B1, E1>>& x,
+		const tvec3<static_float::usf<B2, E2>>& y
+	) {
+		return static_float::dot<3>(&x.x, &y.x);
+	}
+
+	template<uint B1, int E1, uint B2, int E2>
+	typename rt::dot<
+		static_float::sf<B1, E1>,
+		static_float::usf<B2, E2>,
+		3
+	>::rt
+	dot(
+		const tvec3<static_float::sf<B1, E1>>& x,
+		const tvec3<static_float::usf<B2, E2>>& y
+	) {
+		return static_float::dot<3>(&x.x, &y.x);
+	}
+
+	template<uint B1, int E1, uint B2, int E2>
+	typename rt::dot<
+		static_float::sf<B1, E1>,
+		static_float::sf<B2, E2>,
+		4
+	>::rt
+	dot(
+		const tvec4<static_float::sf<B1, E1>>& x,
+		const tvec4<static_float::sf<B2, E2>>& y
+	) {
+		return static_float::dot<4>(&x.x, &y.x);
+	}
+
+	template<uint B1, int E1, uint B2, int E2>
+	typename rt::dot<
+		static_float::usf<B1, E1>,
+		static_float::usf<B2, E2>,
+		4
+	>::rt
+	dot(
+		const tvec4<static_float::usf<B1, E1>>& x,
+		const tvec4<static_float::usf<B2, E2>>& y
+	) {
+		return static_float::dot<4>(&x.x, &y.x);
+	}
+
+	template<uint B1, int E1, uint B2, int E2>
+	typename rt::dot<
+		static_float::sf<B1, E1>,
+		static_float::usf<B2, E2>,
+		4
+	>::rt
+	dot(
+		const tvec4<static_float::sf<B1, E1>>& x,
+		const tvec4<static_float::usf<B2, E2>>& y
+	) {
+		return static_float::dot<4>(&x.x, &y.x);
+	}
+
+	////////////////////////////////////
+
+	namespace detail {
+		/**
+		 * acc = m*v for column-major N x N matrix m.
+		 * Every row have its own accumulator of type CT, so there is no
+		 * re-aligning. Columns are multiplied by broadcasted element of v.
+		 */
+		template<typename CT, uint N, typename T1, typename T2>
+		void mat_vec_num(const T1* m, const T2* v, CT* acc) {
+			for(uint r = 0; r < N; r++){
+				acc[r] = 0;
+			}
+			for(uint c = 0; c < N; c++){
+				CT vc = CT(v[c].num);
+				for(uint r = 0; r < N; r++){
+					acc[r] += CT(m[c*N + r].num) * vc;
+				}
+			}
+		}
+
+		template<typename T1, typename T2, uint N>
+		typename tvec_n<typename rt::dot<T1, T2, N>::rt, N>::type
+		mat_vec(const tmat<T1, N>& m, const T2* v) {
+			typedef rt::dot<T1, T2, N> d;
+			typedef typename tvec_n<typename d::rt, N>::type rt;
+			typename d::ct acc[N];
+			mat_vec_num<typename d::ct, N>(m.data(), v, acc);
+			rt r;
+			for(uint i = 0; i < N; i++){
+				r[i].num = acc[i];
+			}
+			return r;
+		}
+	} // namespace detail
+
+	/**
+	 * Matrix-vector product.
+	 * Width of elements is by rt::dot rule, B1+B2+ceil(log2(N)).
+	 */
+	template<typename T1, typename T2>
+	tvec2<typename rt::dot<T1, T2, 2>::rt>
+	operator*(const tmat2<T1>& m, const tvec2<T2>& v) {
+		return detail::mat_vec(m, &v.x);
+	}
+
+	template<typename T1, typename T2>
+	tvec3<typename rt::dot<T1, T2, 3>::rt>
+	operator*(const tmat3<T1>& m, const tvec3<T2>& v) {
+		return detail::mat_vec(m, &v.x);
+	}
+
+	template<typename T1, typename T2>
+	tvec4<typename rt::dot<T1, T2, 4>::rt>
+	operator*(const tmat4<T1>& m, const tvec4<T2>& v) {
+		return detail::mat_vec(m, &v.x);
+	}
+
+	/**
+	 * Matrix-matrix product.
+	 */
+	template<typename T1, typename T2, uint N>
+	tmat<typename rt::dot<T1, T2, N>::rt, N>
+	operator*(const tmat<T1, N>& m1, const tmat<T2, N>& m2) {
+		tmat<typename rt::dot<T1, T2, N>::rt, N> r;
+		for(uint c = 0; c < N; c++){
+			r[c] = detail::mat_vec(m1, &m2[c].x);
+		}
+		return r;
+	}
+
+	////////////////////////////////////
+
+	/**
+	 * Transform n vectors with same matrix, out[i] = m*in[i].
+	 */
+	template<typename T1, typename T2>
+	void transform(
+		const tmat3<T1>& m,
+		const tvec3<T2>* in,
+		tvec3<typename rt::dot<T1, T2, 3>::rt>* out,
+		size_t n
+	) {
+		typedef typename rt::dot<T1, T2, 3>::ct ct;
+
+		// Matrix is kept in registers during whole loop.
+		ct mm[3][3];
+		for(uint c = 0; c < 3; c++){
+			for(uint r = 0; r < 3; r++){
+				mm[c][r] = ct(m[c][r].num);
+			}
+		}
+
+		for(size_t i = 0; i < n; i++){
+			ct x = ct(in[i].x.num);
+			ct y = ct(in[i].y.num);
+			ct z = ct(in[i].z.num);
+			out[i].x.num = mm[0][0]*x + mm[1][0]*y + mm[2][0]*z;
+			out[i].y.num = mm[0][1]*x + mm[1][1]*y + mm[2][1]*z;
+			out[i].z.num = mm[0][2]*x + mm[1][2]*y + mm[2][2]*z;
+		}
+	}
+
+	/**
+	 * Transform n points with affine matrix, out[i] = (m*vec4(in[i], 1)).xyz.
+	 * Translation column is shifted to exponent of products once, before
+	 * the loop.
+	 */
+	template<typename T1, typename T2>
+	void transform_points(
+		const tmat4<T1>& m,
+		const tvec3<T2>* in,
+		tvec3<typename rt::dot<T1, T2, 4>::rt>* out,
+		size_t n
+	) {
+		static_assert(T2::e <= 0 && int(T2::b) + T2::e > 0,
+				"Type of points cannot represent 1!");
+		typedef typename rt::dot<T1, T2, 4>::ct ct;
+
+		ct mm[4][3];
+		for(uint c = 0; c < 4; c++){
+			for(uint r = 0; r < 3; r++){
+				mm[c][r] = ct(m[c][r].num);
+			}
+		}
+		for(uint r = 0; r < 3; r++){
+			mm[3][r] <<= uint(-T2::e);
+		}
+
+		for(size_t i = 0; i < n; i++){
+			ct x = ct(in[i].x.num);
+			ct y = ct(in[i].y.num);
+			ct z = ct(in[i].z.num);
+			out[i].x.num = mm[0][0]*x + mm[1][0]*y + mm[2][0]*z + mm[3][0];
+			out[i].y.num = mm[0][1]*x + mm[1][1]*y + mm[2][1]*z + mm[3][1];
+			out[i].z.num = mm[0][2]*x + mm[1][2]*y + mm[2][2]*z + mm[3][2];
+		}
+	}
+
+	////////////////////////////////////
+
 	template<uint B, int E>
 	tvec3<typename rt::normalize<static_float::sf<B, E>>::rt>
 	normalize_inversesqrt(const tvec3<static_float::sf<B, E>>& v) {
@@ -64,15 +327,16 @@ namespace vector_math {
 		n.y.num = v.y.num;
 		n.z.num = v.z.num;
 
-		// Rotate left (multiply by 2) until at least one element
-		// is [0.5, 1.0), by checking if B bit is 1.
-
-		elem_t one_half = 0.5;
-		while(abs(n.x) < 0.5 && abs(n.y) < 0.5 && abs(n.z) < 0.5){
-			n.x.num <<= 1;
-			n.y.num <<= 1;
-			n.z.num <<= 1;
-		}
+		// Shift left (multiply by 2^sh) so at least one element
+		// is [0.5, 1.0), ie. have bit B-1 of magnitude set.
+		const uint wx = bit_width(abs(n.x));
+		const uint wy = bit_width(abs(n.y));
+		const uint wz = bit_width(abs(n.z));
+		const uint w = wx > wy ? (wx > wz ? wx : wz) : (wy > wz ? wy : wz);
+		const uint sh = w < B ? B - w : 0;
+		n.x.num <<= sh;
+		n.y.num <<= sh;
+		n.z.num <<= sh;
 
 		auto len_sq = sq(n.x) + sq(n.y) + sq(n.z);
 
@@ -84,9 +348,9 @@ namespace vector_math {
 
 		// Sign of f_min is always 1 and sign of f_max is 0.
 		for(uint i = 0; i < B+1; i++){
-			// New half.
-			// TODO Maybe some better way for calculating half.
-			scale_t s_half = scale_t((s_min + s_max) >> 1);
+			// New half. Halving of sum is free, only rounding to scale_t
+			// is shift.
+			scale_t s_half = scale_t(scale_pow2<-1>(s_min + s_max));
 
 			// Calculate function.
 			auto f_half	= s_half*s_half*len_sq - 1;
@@ -26,6 +26,55 @@
 
 namespace vector_math {
 
+	template<typename T>
+	class tvec2 : public glm::detail::tvec2<T> {
+	public:
+		typedef T value_type;
+
+		//////////////////////////////////////
+		// Implicit basic constructors
+
+		tvec2()
+				: glm::detail::tvec2<T>() {
+		}
+		template <typename U>
+		tvec2(tvec2<U> const & v)
+				: glm::detail::tvec2<T>(v.x, v.y) {
+		}
+		template <typename U>
+		tvec2(glm::detail::tvec2<U> const & v)
+				: glm::detail::tvec2<T>(v) {
+		}
+
+		//////////////////////////////////////
+		// Explicit basic constructors
+
+		template <typename U>
+		explicit tvec2(U const & s)
+				: glm::detail::tvec2<T>(s) {
+		}
+		template <typename U, typename V>
+		explicit tvec2(
+				U const & x,
+				V const & y)
+				: glm::detail::tvec2<T>(x, y) {
+		}
+
+		//////////////////////////////////////
+
+		tvec2<T> & operator=(tvec2<T> const & v){
+			glm::detail::tvec2<T>::operator=(v);
+			return *this;
+		}
+		template <typename U>
+		tvec2<T> & operator=(glm::detail::tvec2<U> const & v){
+			glm::detail::tvec2<T>::operator=(v);
+			return *this;
+		}
+
+		////////////////////////////////
+	};
+
 	template<typename T>
 	class tvec3 : public glm::detail::tvec3<T> {
 	public:
@@ -87,6 +136,148 @@ namespace vector_math {
 		////////////////////////////////
 	};
 
+	template<typename T>
+	class tvec4 : public glm::detail::tvec4<T> {
+	public:
+		typedef T value_type;
+
+		//////////////////////////////////////
+		// Implicit basic constructors
+
+		tvec4()
+				: glm::detail::tvec4<T>() {
+		}
+		template <typename U>
+		tvec4(tvec4<U> const & v)
+				: glm::detail::tvec4<T>(v.x, v.y, v.z, v.w) {
+		}
+		template <typename U>
+		tvec4(glm::detail::tvec4<U> const & v)
+				: glm::detail::tvec4<T>(v) {
+		}
+
+		//////////////////////////////////////
+		// Explicit basic constructors
+
+		template <typename U>
+		explicit tvec4(U const & s)
+				: glm::detail::tvec4<T>(s) {
+		}
+		template <typename U, typename V, typename W, typename X>
+		explicit tvec4(
+				U const & x,
+				V const & y,
+				W const & z,
+				X const & w)
+				: glm::detail::tvec4<T>(x, y, z, w) {
+		}
+
+		//////////////////////////////////////
+
+		tvec4<T> & operator=(tvec4<T> const & v){
+			glm::detail::tvec4<T>::operator=(v);
+			return *this;
+		}
+		template <typename U>
+		tvec4<T> & operator=(glm::detail::tvec4<U> const & v){
+			glm::detail::tvec4<T>::operator=(v);
+			return *this;
+		}
+
+		////////////////////////////////
+	};
+
+	////////////////////////////////////
+
+	namespace detail {
+		template<typename T, uint N>
+		struct tvec_n {
+		};
+
+		template<typename T>
+		struct tvec_n<T, 2> {
+			typedef tvec2<T> type;
+		};
+
+		template<typename T>
+		struct tvec_n<T, 3> {
+			typedef tvec3<T> type;
+		};
+
+		template<typename T>
+		struct tvec_n<T, 4> {
+			typedef tvec4<T> type;
+		};
+	} // namespace detail
+
+	/**
+	 * @class tmat
+	 * @brief Square N x N matrix.
+	 * Like in glm, matrix is array of column vectors, so all N*N elements
+	 * are contiguous in column-major order and column could be loaded
+	 * with single vector load.
+	 * @param T element type
+	 * @param N number of rows and columns
+	 */
+	template<typename T, uint N>
+	class tmat {
+	public:
+		typedef T value_type;
+		typedef typename detail::tvec_n<T, N>::type col_type;
+
+		static constexpr uint n = N;
+
+		col_type value[N];
+
+		////////////////////////////////
+
+	public:
+		tmat() {
+		}
+
+		template<typename U>
+		explicit tmat(const tmat<U, N>& m) {
+			for(uint c = 0; c < N; c++){
+				value[c] = col_type(m[c]);
+			}
+		}
+
+		////////////////////////////////
+
+	public:
+		col_type& operator[](uint c) {
+			return value[c];
+		}
+
+		const col_type& operator[](uint c) const {
+			return value[c];
+		}
+
+		/**
+		 * @return pointer to N*N elements in column-major order.
+		 */
+		T* data() {
+			static_assert(sizeof(col_type) == N*sizeof(T), "Padded column!");
+			return &value[0].x;
+		}
+
+		const T* data() const {
+			static_assert(sizeof(col_type) == N*sizeof(T), "Padded column!");
+			return &value[0].x;
+		}
+
+		////////////////////////////////
+	};
+
+	template<typename T>
+	using tmat2 = tmat<T, 2>;
+
+	template<typename T>
+	using tmat3 = tmat<T, 3>;
+
+	template<typename T>
+	using tmat4 = tmat<T, 4>;
+
 	////////////////////////////////////
 
 	template<typename T1, typename T2>